@@ -0,0 +1,100 @@
+/**
+ * @file SpeedMeasurement.cpp
+ * @brief Hardware-independent speed measurement core
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "SpeedMeasurement.h"
+
+// ==================== Timer Extension ====================
+
+uint32_t extendTimerCount(uint16_t count, uint16_t overflows, bool overflowPending) {
+  uint16_t high = overflows;
+  if (overflowPending && count < 0x8000) {
+    high++;
+  }
+  return ((uint32_t)high << 16) | count;
+}
+
+// ==================== EdgeRecorder ====================
+
+EdgeRecorder::EdgeRecorder(uint32_t minPeriodTicks)
+    : m_lastEdgeTicks(0), m_edgeCount(0), m_minPeriodTicks(minPeriodTicks) {
+}
+
+void EdgeRecorder::onEdge(uint32_t ticks) {
+  if (m_edgeCount != 0 && ticks - m_lastEdgeTicks < m_minPeriodTicks) {
+    return;
+  }
+  m_lastEdgeTicks = ticks;
+  m_edgeCount = m_edgeCount + 1;
+}
+
+void EdgeRecorder::reset() {
+  m_lastEdgeTicks = 0;
+  m_edgeCount = 0;
+}
+
+// ==================== PeriodSpeedEstimator ====================
+
+PeriodSpeedEstimator::PeriodSpeedEstimator(uint32_t ticksPerSecond, uint32_t timeoutTicks)
+    : m_ticksPerSecond(ticksPerSecond),
+      m_ticksPerUs(ticksPerSecond / 1000000UL),
+      m_timeoutTicks(timeoutTicks),
+      m_publishedEdgeTicks(0),
+      m_publishedEdgeCount(0),
+      m_periodTicks(0) {
+}
+
+void PeriodSpeedEstimator::reset() {
+  m_publishedEdgeTicks = 0;
+  m_publishedEdgeCount = 0;
+  m_periodTicks = 0;
+}
+
+SpeedSample PeriodSpeedEstimator::update(uint32_t edgeTicks, uint32_t edgeCount, uint32_t nowTicks) {
+  SpeedSample sample;
+  sample.pulses = edgeCount - m_publishedEdgeCount;
+  sample.periodUs = 0;
+  sample.pulsePerSec = 0.0f;
+
+  if (sample.pulses > 0) {
+    if (m_publishedEdgeCount > 0) {
+      m_periodTicks = (edgeTicks - m_publishedEdgeTicks) / sample.pulses;
+      if (m_periodTicks > m_timeoutTicks) {
+        m_periodTicks = 0;  // First edge after standing still: no period yet
+      }
+    }
+    m_publishedEdgeTicks = edgeTicks;
+    m_publishedEdgeCount = edgeCount;
+  }
+
+  uint32_t sinceEdge = nowTicks - m_publishedEdgeTicks;
+  if (m_periodTicks == 0 || sinceEdge > m_timeoutTicks) {
+    m_periodTicks = 0;
+    return sample;
+  }
+
+  uint32_t period = m_periodTicks > sinceEdge ? m_periodTicks : sinceEdge;
+  sample.periodUs = period / m_ticksPerUs;
+  sample.pulsePerSec = (float)m_ticksPerSecond / period;
+  return sample;
+}
+
+// ==================== PulseCountEstimator ====================
+
+PulseCountEstimator::PulseCountEstimator(uint32_t intervalMs)
+    : m_intervalMs(intervalMs) {
+}
+
+SpeedSample PulseCountEstimator::update(uint32_t pulses) const {
+  // Convert to pulses per second
+  // Formula: (pulses / interval_seconds) = pulses per second
+  SpeedSample sample;
+  float intervalSeconds = m_intervalMs / 1000.0;
+  sample.pulses = pulses;
+  sample.pulsePerSec = pulses / intervalSeconds;
+  sample.periodUs = pulses > 0 ? (m_intervalMs * 1000UL) / pulses : 0;
+  return sample;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file SpeedMeasurement.h
+ * @brief Hardware-independent speed measurement core
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * @description
+ * The pulse-to-speed logic of the firmware, free of Arduino.h and AVR
+ * registers so the same code builds for the Uno and natively on the host
+ * (pio test -e native). main.cpp owns the hardware: it reads Timer1, runs
+ * the ISRs and disables interrupts around snapshots; this library only
+ * sees tick counts.
+ *
+ * Two estimators:
+ * - PulseCountEstimator: pulses counted over a fixed window (INT0 mode)
+ * - PeriodSpeedEstimator: inter-pulse periods from timestamped edges
+ *   recorded by EdgeRecorder (Timer1 input capture mode)
+ */
+
+#ifndef SPEED_MEASUREMENT_H
+#define SPEED_MEASUREMENT_H
+
+#include <stdint.h>
+
+/**
+ * @brief One published speed value
+ */
+struct SpeedSample {
+  uint32_t pulses;        // Edges in the last update interval
+  uint32_t periodUs;      // Pulse period behind pulsePerSec, 0 = stopped
+  float pulsePerSec;
+};
+
+/**
+ * @brief Extend a 16-bit Timer1 value (TCNT1 or ICR1) to 32 bits
+ * @param count Timer value, read with interrupts disabled
+ * @param overflows Overflows counted by the overflow ISR so far
+ * @param overflowPending TOV1 was set when count was read
+ * @note A pending overflow belongs to the count only if the count is small,
+ *       i.e. it was taken after the wrap
+ */
+uint32_t extendTimerCount(uint16_t count, uint16_t overflows, bool overflowPending);
+
+/**
+ * @class EdgeRecorder
+ * @brief ISR side of the input capture mode: newest edge time and edge count
+ *
+ * onEdge() runs in the capture ISR. Edges closer than minPeriodTicks to the
+ * previous accepted edge are comparator chatter and are dropped.
+ * edgeTicks()/edgeCount() must be read with interrupts disabled.
+ */
+class EdgeRecorder {
+public:
+  explicit EdgeRecorder(uint32_t minPeriodTicks);
+
+  void onEdge(uint32_t ticks);
+  void reset();
+
+  uint32_t edgeTicks() const { return m_lastEdgeTicks; }
+  uint32_t edgeCount() const { return m_edgeCount; }
+
+private:
+  volatile uint32_t m_lastEdgeTicks;    // Timestamp of the newest accepted edge
+  volatile uint32_t m_edgeCount;        // Accepted edges since reset
+  uint32_t m_minPeriodTicks;
+};
+
+/**
+ * @class PeriodSpeedEstimator
+ * @brief Speed from the inter-pulse period, evaluated at a fixed rate
+ *
+ * - Several edges since the last update (high speed): average period over
+ *   all of them, (newest edge - previous newest edge) / edges
+ * - No new edge (low speed): the pulse in progress is already longer than
+ *   the elapsed time, so the period is at least (now - newest edge); this
+ *   lets speed decay smoothly while slowing down
+ * - No edge for timeoutTicks: speed is zero
+ */
+class PeriodSpeedEstimator {
+public:
+  // ticksPerSecond must be a multiple of 1000000 (whole ticks per microsecond)
+  PeriodSpeedEstimator(uint32_t ticksPerSecond, uint32_t timeoutTicks);
+
+  SpeedSample update(uint32_t edgeTicks, uint32_t edgeCount, uint32_t nowTicks);
+  void reset();
+
+private:
+  uint32_t m_ticksPerSecond;
+  uint32_t m_ticksPerUs;
+  uint32_t m_timeoutTicks;
+  uint32_t m_publishedEdgeTicks;    // Newest edge seen by the previous update
+  uint32_t m_publishedEdgeCount;    // Edge count seen by the previous update
+  uint32_t m_periodTicks;           // Averaged pulse period, 0 = unknown
+};
+
+/**
+ * @class PulseCountEstimator
+ * @brief Speed from the number of pulses in a fixed window
+ */
+class PulseCountEstimator {
+public:
+  explicit PulseCountEstimator(uint32_t intervalMs);
+
+  SpeedSample update(uint32_t pulses) const;
+
+private:
+  uint32_t m_intervalMs;
+};
+
+#endif // SPEED_MEASUREMENT_H
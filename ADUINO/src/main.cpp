@@ -4,43 +4,204 @@
  * @author Ahn Hyunjun
  * @date 2026-02-12
  * @version 1.0.0
- * 
+ *
  * @description
  * Real-time speed measurement system for PiRacer autonomous vehicle.
  * Uses LM393 infrared speed sensor with interrupt-based pulse counting
  * for accurate speed monitoring via serial communication.
- * 
+ *
+ * Two measurement modes (selected at build time):
+ * - Pulse counting (default): FALLING edges counted on INT0 and divided
+ *   by a fixed 500 ms window
+ * - Input capture (SPEED_MEASUREMENT_ICP=1, env:uno_icp): every edge is
+ *   timestamped by Timer1 (ICP1) and speed comes from the inter-pulse
+ *   period, published at 50 Hz
+ *
+ * Output (selected at build time):
+ * - Binary speed frames (default): 13 bytes per update, see sendSpeedFrame()
+ * - Text lines (SPEED_OUTPUT_TEXT=1, env:uno_text): human-readable debug
+ *   output, "Pulses: N | Speed: X pulse/s | Time: T s"
+ * - CAN frames (SPEED_OUTPUT_CAN=1, env:uno_can): speed in km/h on ID 0x123
+ *   through an MCP2515, see sendSpeedCan()
+ *
  * @hardware
  * - Arduino Uno/Nano (ATmega328P)
  * - LM393 Speed Sensor Module
  * - PiRacer Platform
- * 
+ *
  * @pin_configuration
- * LM393 DO -> Arduino Pin 2 (INT0)
+ * LM393 DO -> Arduino Pin 2 (INT0), or Pin 8 (ICP1) in input capture mode
  * LM393 VCC -> 5V
  * LM393 GND -> GND
+ * MCP2515 (CAN output only): CS -> Pin 10, SI -> 11, SO -> 12, SCK -> 13
  */
 
 #include <Arduino.h>
+#include <SpeedMeasurement.h>
 
 // ==================== Configuration ====================
 
+// Measurement mode: 0 = pulse counting (INT0), 1 = Timer1 input capture (ICP1)
+#ifndef SPEED_MEASUREMENT_ICP
+#define SPEED_MEASUREMENT_ICP 0
+#endif
+
+// Output format: 0 = binary speed frames, 1 = text lines (debug)
+#ifndef SPEED_OUTPUT_TEXT
+#define SPEED_OUTPUT_TEXT 0
+#endif
+
+// CAN output: 1 = speed frames via MCP2515 instead of serial output
+#ifndef SPEED_OUTPUT_CAN
+#define SPEED_OUTPUT_CAN 0
+#endif
+
+#if SPEED_OUTPUT_CAN
+#include <SPI.h>
+#include <mcp2515.h>
+
+#if !SPEED_MEASUREMENT_ICP
+#error "SPEED_OUTPUT_CAN needs SPEED_MEASUREMENT_ICP=1 (pulse counting has no resolution at 50-100 Hz)"
+#endif
+
+#ifndef CAN_PUBLISH_HZ
+#define CAN_PUBLISH_HZ      100     // Speed frames per second
+#endif
+#if CAN_PUBLISH_HZ < 50 || CAN_PUBLISH_HZ > 100
+#error "CAN_PUBLISH_HZ must be between 50 and 100"
+#endif
+
+#ifndef CAN_BITRATE
+#define CAN_BITRATE         CAN_500KBPS   // Must match "ip link set can0 type can bitrate ..."
+#endif
+#ifndef MCP2515_CLOCK
+#define MCP2515_CLOCK       MCP_8MHZ      // Crystal on the MCP2515 module
+#endif
+#ifndef PULSE_TO_KMH
+#define PULSE_TO_KMH        0.72          // speed.pulses_per_second_to_kmh in calibration.json
+#endif
+
+#define MCP2515_CS_PIN      10
+#define SPEED_CAN_ID        0x123
+
+// Nearest whole millisecond: 60 Hz -> 17 ms (58.8 Hz), not 16 ms (62.5 Hz)
+#define UPDATE_INTERVAL_MS  ((1000 + CAN_PUBLISH_HZ / 2) / CAN_PUBLISH_HZ)
+#define CAN_STATUS_INTERVAL_MS 1000 // TX error report period on serial
+#endif
+
+// Binary speed frame
+#define SPEED_FRAME_SYNC    0xA5    // First byte of every frame (never in text output)
+#define SPEED_FRAME_SIZE    13      // sync + seq + timestamp + pulses + period + crc
+
+#ifndef SERIAL_BAUD_RATE
+#define SERIAL_BAUD_RATE    9600    // Serial communication baud rate
+#endif
+
+#if SPEED_MEASUREMENT_ICP
+
+// Pin Definitions
+#define SPEED_SENSOR_PIN    8       // Digital pin 8 (ICP1, fixed by hardware)
+
+// Timing Configuration
+#ifndef UPDATE_INTERVAL_MS
+#define UPDATE_INTERVAL_MS  20      // Publish interval (milliseconds, 50 Hz)
+#endif
+#define ZERO_SPEED_TIMEOUT_MS 500   // No edge for this long -> speed 0
+#define MIN_PULSE_PERIOD_US 200     // Shorter periods are comparator chatter
+
+// Timer1 runs at F_CPU / 8: 1 us per tick at 8 MHz, 0.5 us at 16 MHz
+#define TIMER1_TICKS_PER_SECOND (F_CPU / 8UL)
+#define US_TO_TICKS(us)     ((unsigned long)(us) * (TIMER1_TICKS_PER_SECOND / 1000000UL))
+
+#else
+
 // Pin Definitions
 #define SPEED_SENSOR_PIN    2       // Digital pin 2 (interrupt capable)
-#define SERIAL_BAUD_RATE    9600    // Serial communication baud rate
 
 // Timing Configuration
 #define UPDATE_INTERVAL_MS  500     // Speed update interval (milliseconds)
 
+#endif
+
 // ==================== Global Variables ====================
 
 // Speed measurement variables
-volatile unsigned long g_pulseCount = 0;    // Pulse counter (modified by ISR)
 unsigned long g_lastUpdateTime = 0;         // Last speed calculation timestamp
-float g_currentSpeed = 0.0;                 // Current speed (pulses per second)
+SpeedSample g_speed = {0, 0, 0.0};          // Current speed, period and pulse count
+uint8_t g_frameSequence = 0;                // Binary frame sequence number (wraps)
+
+#if SPEED_OUTPUT_CAN
+MCP2515 g_canController(MCP2515_CS_PIN);
+uint8_t g_canCounter = 0;                   // Rolling counter in byte 2 of 0x123
+unsigned long g_canTxErrors = 0;            // Frames the MCP2515 did not accept
+unsigned long g_reportedCanTxErrors = 0;    // g_canTxErrors at the last report
+unsigned long g_lastCanStatusTime = 0;      // Last TX error report timestamp
+#endif
+
+#if SPEED_MEASUREMENT_ICP
+// Written by the Timer1 ISRs
+volatile uint16_t g_timer1Overflows = 0;    // Upper 16 bits of the 32-bit tick clock
+EdgeRecorder g_edges(US_TO_TICKS(MIN_PULSE_PERIOD_US));
+
+// Owned by loop()
+PeriodSpeedEstimator g_estimator(TIMER1_TICKS_PER_SECOND,
+                                 US_TO_TICKS(ZERO_SPEED_TIMEOUT_MS * 1000UL));
+#else
+volatile unsigned long g_pulseCount = 0;    // Pulse counter (modified by ISR)
+PulseCountEstimator g_estimator(UPDATE_INTERVAL_MS);
+#endif
+
+// ==================== Function Prototypes ====================
+
+void calculateSpeed();
+void displaySpeed();
+void resetCounters();
+void printStartupBanner();
+void sendSpeedFrame();
+void sendSpeedCan();
+void reportCanStatus();
+uint8_t crc8(const uint8_t *data, uint8_t length);
 
 // ==================== Interrupt Service Routine ====================
 
+#if SPEED_MEASUREMENT_ICP
+
+/**
+ * @brief Extend the 16-bit Timer1 count to 32 bits
+ * @param count TCNT1 or ICR1 value read with interrupts disabled
+ */
+static inline unsigned long extendTimer1(unsigned int count) {
+  return extendTimerCount(count, g_timer1Overflows, TIFR1 & _BV(TOV1));
+}
+
+/**
+ * @brief Timer1 overflow: advance the upper half of the tick clock
+ */
+ISR(TIMER1_OVF_vect) {
+  g_timer1Overflows++;
+}
+
+/**
+ * @brief Timer1 input capture: timestamp one FALLING edge on ICP1
+ * @note The edge time is latched in ICR1 by hardware, so ISR latency
+ *       does not affect the measured period
+ */
+ISR(TIMER1_CAPT_vect) {
+  g_edges.onEdge(extendTimer1(ICR1));
+}
+
+/**
+ * @brief Current time on the Timer1 tick clock
+ */
+unsigned long timer1Now() {
+  noInterrupts();
+  unsigned long ticks = extendTimer1(TCNT1);
+  interrupts();
+  return ticks;
+}
+
+#else
+
 /**
  * @brief Interrupt Service Routine for pulse counting
  * @note Called automatically on FALLING edge detection
@@ -50,6 +211,8 @@ void ISR_countPulse() {
   g_pulseCount++;
 }
 
+#endif
+
 // ==================== Setup Function ====================
 
 /**
@@ -61,18 +224,40 @@ void setup() {
   while (!Serial) {
     ; // Wait for serial port to connect (needed for native USB)
   }
-  
+
   // Configure sensor pin
   pinMode(SPEED_SENSOR_PIN, INPUT);
-  
+
+#if SPEED_OUTPUT_CAN
+  // MCP2515: reset, set bit timing, join the bus
+  SPI.begin();
+  if (g_canController.reset() != MCP2515::ERROR_OK ||
+      g_canController.setBitrate(CAN_BITRATE, MCP2515_CLOCK) != MCP2515::ERROR_OK ||
+      g_canController.setNormalMode() != MCP2515::ERROR_OK) {
+    Serial.println(F("ERROR: MCP2515 not responding, check SPI wiring and crystal"));
+  }
+#endif
+
+#if SPEED_MEASUREMENT_ICP
+  // Timer1 free-running: normal mode, clk/8, capture on falling edge
+  // (ICES1 = 0) with the 4-sample noise canceler enabled
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = _BV(ICNC1) | _BV(CS11);
+  TCNT1 = 0;
+  TIFR1 = _BV(ICF1) | _BV(TOV1);
+  TIMSK1 = _BV(ICIE1) | _BV(TOIE1);
+  interrupts();
+#else
   // Attach interrupt on falling edge (HIGH to LOW transition)
-  attachInterrupt(digitalPinToInterrupt(SPEED_SENSOR_PIN), 
-                  ISR_countPulse, 
+  attachInterrupt(digitalPinToInterrupt(SPEED_SENSOR_PIN),
+                  ISR_countPulse,
                   FALLING);
-  
+#endif
+
   // Print startup banner
   printStartupBanner();
-  
+
   // Initialize timestamp
   g_lastUpdateTime = millis();
 }
@@ -84,47 +269,188 @@ void setup() {
  */
 void loop() {
   unsigned long currentTime = millis();
-  
+
   // Check if update interval has elapsed
   if (currentTime - g_lastUpdateTime >= UPDATE_INTERVAL_MS) {
     calculateSpeed();
     displaySpeed();
     resetCounters();
-    
+
+#if SPEED_MEASUREMENT_ICP
+    // Fixed publish rate: advance by the interval, resync after a stall
+    g_lastUpdateTime += UPDATE_INTERVAL_MS;
+    if (currentTime - g_lastUpdateTime >= UPDATE_INTERVAL_MS) {
+      g_lastUpdateTime = currentTime;
+    }
+#else
     g_lastUpdateTime = currentTime;
+#endif
+  }
+
+#if SPEED_OUTPUT_CAN
+  if (currentTime - g_lastCanStatusTime >= CAN_STATUS_INTERVAL_MS) {
+    reportCanStatus();
+    g_lastCanStatusTime = currentTime;
   }
+#endif
 }
 
 // ==================== Helper Functions ====================
 
 /**
- * @brief Calculate speed from pulse count
+ * @brief Calculate speed (see SpeedMeasurement.h for the algorithms)
  */
 void calculateSpeed() {
-  // Convert to pulses per second
-  // Formula: (pulses / interval_seconds) = pulses per second
-  float intervalSeconds = UPDATE_INTERVAL_MS / 1000.0;
-  g_currentSpeed = g_pulseCount / intervalSeconds;
+#if SPEED_MEASUREMENT_ICP
+  noInterrupts();
+  unsigned long edgeTicks = g_edges.edgeTicks();
+  unsigned long edgeCount = g_edges.edgeCount();
+  interrupts();
+  g_speed = g_estimator.update(edgeTicks, edgeCount, timer1Now());
+#else
+  g_speed = g_estimator.update(g_pulseCount);
+#endif
 }
 
 /**
  * @brief Display speed data on serial monitor
  */
 void displaySpeed() {
+#if SPEED_OUTPUT_CAN
+  sendSpeedCan();
+#elif !SPEED_OUTPUT_TEXT
+  sendSpeedFrame();
+#else
   Serial.print("Pulses: ");
-  Serial.print(g_pulseCount);
+  Serial.print(g_speed.pulses);
   Serial.print(" | Speed: ");
-  Serial.print(g_currentSpeed, 2);  // 2 decimal places
+  Serial.print(g_speed.pulsePerSec, 2);  // 2 decimal places
   Serial.print(" pulse/s | Time: ");
   Serial.print(millis() / 1000.0, 2);
   Serial.println(" s");
+#endif
+}
+
+/**
+ * @brief Send one binary speed frame
+ *
+ * Layout (13 bytes, multi-byte fields little-endian):
+ * | Byte  | Field     | Description                                   |
+ * |-------|-----------|-----------------------------------------------|
+ * | 0     | sync      | 0xA5                                          |
+ * | 1     | sequence  | Increments by one per frame, wraps at 255     |
+ * | 2-5   | timestamp | micros() when the frame was built             |
+ * | 6-7   | pulses    | Edges counted in this update interval         |
+ * | 8-11  | period    | Pulse period in microseconds, 0 = stopped     |
+ * | 12    | crc       | CRC-8 (poly 0x07, init 0x00) over bytes 1-11  |
+ *
+ * Speed in pulse/s is 1000000 / period. At 9600 baud a frame takes
+ * 13.5 ms on the wire, against ~60 ms for the text line.
+ */
+void sendSpeedFrame() {
+  uint8_t frame[SPEED_FRAME_SIZE];
+  unsigned long timestamp = micros();
+  unsigned int pulses = g_speed.pulses > 0xFFFF ? 0xFFFF : g_speed.pulses;
+
+  frame[0] = SPEED_FRAME_SYNC;
+  frame[1] = g_frameSequence++;
+  frame[2] = timestamp & 0xFF;
+  frame[3] = (timestamp >> 8) & 0xFF;
+  frame[4] = (timestamp >> 16) & 0xFF;
+  frame[5] = (timestamp >> 24) & 0xFF;
+  frame[6] = pulses & 0xFF;
+  frame[7] = (pulses >> 8) & 0xFF;
+  frame[8] = g_speed.periodUs & 0xFF;
+  frame[9] = (g_speed.periodUs >> 8) & 0xFF;
+  frame[10] = (g_speed.periodUs >> 16) & 0xFF;
+  frame[11] = (g_speed.periodUs >> 24) & 0xFF;
+  frame[12] = crc8(&frame[1], SPEED_FRAME_SIZE - 2);
+
+  Serial.write(frame, SPEED_FRAME_SIZE);
+}
+
+#if SPEED_OUTPUT_CAN
+
+/**
+ * @brief Send the speed on CAN ID 0x123
+ *
+ * | Byte | Description                                                 |
+ * |------|-------------------------------------------------------------|
+ * | 0    | Speed, integer km/h (same as the original 1-byte format)    |
+ * | 1    | Speed, fraction in 1/256 km/h                               |
+ * | 2    | Rolling counter, +1 per publish; gaps mean lost frames      |
+ * | 3-7  | Reserved, 0                                                 |
+ *
+ * Bytes 0-1 read as a big-endian unsigned 16-bit value are km/h * 256
+ * (DBC: Speed : 7|16@0+ (0.00390625,0)).
+ */
+void sendSpeedCan() {
+  struct can_frame frame;
+  float kmh = g_speed.pulsePerSec * PULSE_TO_KMH;
+  unsigned long fixed = (unsigned long)(kmh * 256.0 + 0.5);
+  if (fixed > 0xFFFF) {
+    fixed = 0xFFFF;
+  }
+
+  frame.can_id = SPEED_CAN_ID;
+  frame.can_dlc = 8;
+  frame.data[0] = (fixed >> 8) & 0xFF;
+  frame.data[1] = fixed & 0xFF;
+  frame.data[2] = g_canCounter++;
+  for (uint8_t i = 3; i < 8; i++) {
+    frame.data[i] = 0;
+  }
+
+  // Without another node to ACK, all TX buffers stay busy; count and move on
+  if (g_canController.sendMessage(&frame) != MCP2515::ERROR_OK) {
+    g_canTxErrors++;
+  }
+}
+
+/**
+ * @brief Print the TX error count when frames were rejected since the last report
+ * @note Serial carries no speed data in CAN mode, so this line is the only
+ *       sign of a missing ACK (no other node, wrong bit rate, unplugged bus)
+ */
+void reportCanStatus() {
+  if (g_canTxErrors == g_reportedCanTxErrors) {
+    return;
+  }
+  Serial.print(F("CAN TX errors: "));
+  Serial.print(g_canTxErrors);
+  Serial.print(F(" (+"));
+  Serial.print(g_canTxErrors - g_reportedCanTxErrors);
+  Serial.println(F(")"));
+  g_reportedCanTxErrors = g_canTxErrors;
+}
+
+#endif
+
+/**
+ * @brief CRC-8 with polynomial 0x07 (x^8 + x^2 + x + 1), initial value 0
+ * @param data Bytes to checksum
+ * @param length Number of bytes
+ */
+uint8_t crc8(const uint8_t *data, uint8_t length) {
+  uint8_t crc = 0;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+  }
+  return crc;
 }
 
 /**
  * @brief Reset pulse counter for next measurement cycle
  */
 void resetCounters() {
+#if !SPEED_MEASUREMENT_ICP
   g_pulseCount = 0;
+#endif
+  // Input capture mode: the edge counter keeps running, the estimator
+  // compares it against the count seen by the previous update
 }
 
 /**
@@ -136,10 +462,24 @@ void printStartupBanner() {
   Serial.println(F("========================================="));
   Serial.println(F("Sensor: LM393 IR Speed Sensor"));
   Serial.println(F("Platform: Arduino Uno (ATmega328P)"));
+#if SPEED_MEASUREMENT_ICP
+  Serial.println(F("Mode: Timer1 input capture (pin 8)"));
+#else
+  Serial.println(F("Mode: Pulse counting (pin 2)"));
+#endif
+#if SPEED_OUTPUT_CAN
+  Serial.print(F("Output: CAN 0x123 at "));
+  Serial.print(CAN_PUBLISH_HZ);
+  Serial.println(F(" Hz"));
+#elif SPEED_OUTPUT_TEXT
+  Serial.println(F("Output: Text"));
+#else
+  Serial.println(F("Output: Binary frames"));
+#endif
   Serial.print(F("Update Interval: "));
   Serial.print(UPDATE_INTERVAL_MS);
   Serial.println(F(" ms"));
   Serial.println(F("========================================="));
   Serial.println(F("Starting measurements..."));
   Serial.println();
-}
\ No newline at end of file
+}
@@ -0,0 +1,345 @@
+/**
+ * @file test_main.cpp
+ * @brief Host-side simulation of the speed measurement core
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * @description
+ * Runs SpeedMeasurement against synthetic pulse trains on the host
+ * (pio test -e native). A fake Timer1 clock (1 tick = 1 us, as on the
+ * 8 MHz Uno) timestamps each simulated sensor edge; the edges are fed to
+ * the same code the ISRs call, and the estimators are updated at their
+ * publish rate exactly like loop() does. Reported speed is compared with
+ * the true pulse rate at each publish time.
+ *
+ * Scenarios: constant speed, acceleration ramp, speed step, edge timing
+ * jitter, sensor bounce, stop, Timer1 32-bit wrap. Every scenario prints
+ * error and latency for both algorithms, so a changed or new estimator
+ * can be compared before flashing; the assertions only cover input
+ * capture (the firmware's fast mode).
+ */
+
+#include <SpeedMeasurement.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// ==================== Firmware Parameters ====================
+
+// Same values as main.cpp at F_CPU = 8 MHz (Timer1 clk/8)
+static const uint32_t TICKS_PER_SECOND = 1000000UL;
+static const uint32_t ICP_INTERVAL_MS = 20;
+static const uint32_t COUNT_INTERVAL_MS = 500;
+static const uint32_t ZERO_SPEED_TIMEOUT_MS = 500;
+static const uint32_t MIN_PULSE_PERIOD_US = 200;
+
+// ==================== Pulse Train Simulation ====================
+
+/**
+ * @brief Synthetic sensor signal
+ */
+struct Scenario {
+  const char *name;
+  double (*rate)(double t);   // True pulse rate (pulse/s) at time t
+  double duration;            // Seconds
+  double jitter;              // Edge time noise, fraction of the local period
+  double bounceUs;            // Extra edge this long after each edge, 0 = none
+  uint32_t startTicks;        // Timer1 value at t = 0
+};
+
+/**
+ * @brief One published value next to the truth
+ */
+struct Sample {
+  double time;
+  double reported;
+  double truth;
+};
+
+/**
+ * @brief Edge times (seconds) of a scenario, by integrating its rate
+ */
+static std::vector<double> generateEdges(const Scenario &scenario) {
+  const double dt = 1e-6;
+  std::vector<double> edges;
+  unsigned seed = 12345;
+  double phase = 0.0;
+
+  for (double t = 0.0; t < scenario.duration; t += dt) {
+    const double rate = scenario.rate(t);
+    phase += rate * dt;
+    if (phase < 1.0) {
+      continue;
+    }
+    phase -= 1.0;
+
+    double edge = t;
+    if (scenario.jitter > 0.0 && rate > 0.0) {
+      seed = seed * 1103515245u + 12345u;
+      const double noise = ((seed >> 16) & 0x7FFF) / 16383.5 - 1.0;   // -1..1
+      edge += noise * scenario.jitter / rate;
+    }
+    edges.push_back(edge);
+    if (scenario.bounceUs > 0.0) {
+      edges.push_back(edge + scenario.bounceUs * 1e-6);
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+/**
+ * @brief Fake Timer1: 32-bit tick count at time t
+ */
+static uint32_t ticksAt(const Scenario &scenario, double t) {
+  return scenario.startTicks + (uint32_t)std::llround(t * TICKS_PER_SECOND);
+}
+
+/**
+ * @brief Input capture mode: EdgeRecorder in the "ISR", estimator every 20 ms
+ */
+static std::vector<Sample> runInputCapture(const Scenario &scenario) {
+  const std::vector<double> edges = generateEdges(scenario);
+  EdgeRecorder recorder(MIN_PULSE_PERIOD_US);
+  PeriodSpeedEstimator estimator(TICKS_PER_SECOND, ZERO_SPEED_TIMEOUT_MS * 1000UL);
+  std::vector<Sample> samples;
+
+  size_t next = 0;
+  for (double t = ICP_INTERVAL_MS / 1000.0; t <= scenario.duration; t += ICP_INTERVAL_MS / 1000.0) {
+    while (next < edges.size() && edges[next] <= t) {
+      recorder.onEdge(ticksAt(scenario, edges[next++]));
+    }
+    const SpeedSample sample =
+        estimator.update(recorder.edgeTicks(), recorder.edgeCount(), ticksAt(scenario, t));
+    samples.push_back({t, sample.pulsePerSec, scenario.rate(t)});
+  }
+  return samples;
+}
+
+/**
+ * @brief Pulse counting mode: every edge counted, estimator every 500 ms
+ */
+static std::vector<Sample> runPulseCount(const Scenario &scenario) {
+  const std::vector<double> edges = generateEdges(scenario);
+  PulseCountEstimator estimator(COUNT_INTERVAL_MS);
+  std::vector<Sample> samples;
+
+  size_t next = 0;
+  for (double t = COUNT_INTERVAL_MS / 1000.0; t <= scenario.duration; t += COUNT_INTERVAL_MS / 1000.0) {
+    uint32_t pulses = 0;
+    while (next < edges.size() && edges[next] <= t) {
+      next++;
+      pulses++;
+    }
+    const SpeedSample sample = estimator.update(pulses);
+    samples.push_back({t, sample.pulsePerSec, scenario.rate(t)});
+  }
+  return samples;
+}
+
+// ==================== Metrics ====================
+
+/**
+ * @brief Tracking error over samples in [from, to] with truth >= minTruth
+ */
+struct TrackingError {
+  double meanPct;
+  double maxPct;
+  int samples;
+};
+
+static TrackingError trackingError(const std::vector<Sample> &samples,
+                                   double from, double to, double minTruth) {
+  TrackingError error = {0.0, 0.0, 0};
+  for (const Sample &s : samples) {
+    if (s.time < from || s.time > to || s.truth < minTruth) {
+      continue;
+    }
+    const double pct = 100.0 * std::fabs(s.reported - s.truth) / s.truth;
+    error.meanPct += pct;
+    error.maxPct = std::max(error.maxPct, pct);
+    error.samples++;
+  }
+  if (error.samples > 0) {
+    error.meanPct /= error.samples;
+  }
+  return error;
+}
+
+/**
+ * @brief Time from `from` until the reported speed stays within
+ *        tolerance (pulse/s) of target for the rest of the run
+ * @return Milliseconds, or -1 if it never settles
+ */
+static double settleTimeMs(const std::vector<Sample> &samples, double from,
+                           double target, double tolerance) {
+  double settled = -1.0;
+  for (const Sample &s : samples) {
+    if (s.time < from) {
+      continue;
+    }
+    if (std::fabs(s.reported - target) > tolerance) {
+      settled = -1.0;
+    } else if (settled < 0.0) {
+      settled = s.time;
+    }
+  }
+  return settled < 0.0 ? -1.0 : (settled - from) * 1000.0;
+}
+
+static void printTracking(const char *scenario, const char *algorithm, const TrackingError &error) {
+  printf("  %-14s %-14s mean error %6.2f %%  max error %6.2f %%  (%d samples)\n",
+         scenario, algorithm, error.meanPct, error.maxPct, error.samples);
+}
+
+static void printSettle(const char *scenario, const char *algorithm, double ms) {
+  printf("  %-14s %-14s settle %7.0f ms\n", scenario, algorithm, ms);
+}
+
+// ==================== Pulse Rate Profiles ====================
+
+static double constantRate(double) { return 237.3; }
+static double rampRate(double t) { return t < 4.0 ? 100.0 * t : 400.0; }
+static double stepRate(double t) { return t < 2.0 ? 100.0 : 300.0; }
+static double stopRate(double t) { return t < 2.0 ? 150.0 : 0.0; }
+static double slowRate(double) { return 20.0; }
+
+// ==================== Tests ====================
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_extend_timer_count() {
+  TEST_ASSERT_EQUAL_HEX32(0x00031234, extendTimerCount(0x1234, 3, false));
+  // Overflow pending and the count was taken after the wrap
+  TEST_ASSERT_EQUAL_HEX32(0x00040010, extendTimerCount(0x0010, 3, true));
+  // Overflow pending but the count was taken just before the wrap
+  TEST_ASSERT_EQUAL_HEX32(0x0003FFF0, extendTimerCount(0xFFF0, 3, true));
+  TEST_ASSERT_EQUAL_HEX32(0x00000005, extendTimerCount(0x0005, 0xFFFF, true));
+}
+
+void test_edge_recorder_rejects_chatter() {
+  EdgeRecorder recorder(MIN_PULSE_PERIOD_US);
+  recorder.onEdge(1000);
+  recorder.onEdge(1050);    // Bounce
+  recorder.onEdge(6000);
+  TEST_ASSERT_EQUAL_UINT32(2, recorder.edgeCount());
+  TEST_ASSERT_EQUAL_UINT32(6000, recorder.edgeTicks());
+}
+
+void test_constant_speed() {
+  const Scenario scenario = {"constant", constantRate, 5.0, 0.0, 0.0, 0};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 1.0);
+  const TrackingError count = trackingError(runPulseCount(scenario), 0.5, 5.0, 1.0);
+  printTracking(scenario.name, "input capture", icp);
+  printTracking(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.5f, (float)icp.maxPct);
+}
+
+void test_acceleration_ramp() {
+  const Scenario scenario = {"ramp", rampRate, 5.0, 0.0, 0.0, 0};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 50.0);
+  const TrackingError count = trackingError(runPulseCount(scenario), 0.5, 5.0, 50.0);
+  printTracking(scenario.name, "input capture", icp);
+  printTracking(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(3.0f, (float)icp.meanPct);
+  TEST_ASSERT_LESS_THAN_FLOAT(count.meanPct, (float)icp.meanPct);
+}
+
+void test_speed_step_latency() {
+  const Scenario scenario = {"step", stepRate, 4.0, 0.0, 0.0, 0};
+  const double icp = settleTimeMs(runInputCapture(scenario), 2.0, 300.0, 15.0);
+  const double count = settleTimeMs(runPulseCount(scenario), 2.0, 300.0, 15.0);
+  printSettle(scenario.name, "input capture", icp);
+  printSettle(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_TRUE(icp >= 0.0);
+  TEST_ASSERT_LESS_THAN_FLOAT(50.0f, (float)icp);
+}
+
+void test_edge_jitter() {
+  const Scenario scenario = {"jitter 10%", constantRate, 5.0, 0.10, 0.0, 0};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 1.0);
+  const TrackingError count = trackingError(runPulseCount(scenario), 0.5, 5.0, 1.0);
+  printTracking(scenario.name, "input capture", icp);
+  printTracking(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(5.0f, (float)icp.meanPct);
+}
+
+void test_sensor_bounce() {
+  const Scenario scenario = {"bounce 50us", constantRate, 5.0, 0.0, 50.0, 0};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 1.0);
+  const TrackingError count = trackingError(runPulseCount(scenario), 0.5, 5.0, 1.0);
+  printTracking(scenario.name, "input capture", icp);
+  printTracking(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.5f, (float)icp.maxPct);
+}
+
+void test_stop_times_out_to_zero() {
+  const Scenario scenario = {"stop", stopRate, 4.0, 0.0, 0.0, 0};
+  const std::vector<Sample> icp = runInputCapture(scenario);
+  const double icpMs = settleTimeMs(icp, 2.0, 0.0, 0.0);
+  const double countMs = settleTimeMs(runPulseCount(scenario), 2.0, 0.0, 0.0);
+  printSettle(scenario.name, "input capture", icpMs);
+  printSettle(scenario.name, "pulse count", countMs);
+
+  TEST_ASSERT_TRUE(icpMs >= 0.0);
+  TEST_ASSERT_LESS_THAN_FLOAT((float)(ZERO_SPEED_TIMEOUT_MS + 2 * ICP_INTERVAL_MS), (float)icpMs);
+
+  // While waiting for the timeout the speed only decays
+  double previous = -1.0;
+  for (const Sample &s : icp) {
+    if (s.time < 2.0) {
+      continue;
+    }
+    if (previous >= 0.0) {
+      TEST_ASSERT_TRUE(s.reported <= previous);
+    }
+    previous = s.reported;
+  }
+}
+
+void test_slow_speed_resolution() {
+  // 20 pulse/s: one edge per publish interval at most
+  const Scenario scenario = {"slow 20/s", slowRate, 5.0, 0.0, 0.0, 0};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 1.0);
+  const TrackingError count = trackingError(runPulseCount(scenario), 0.5, 5.0, 1.0);
+  printTracking(scenario.name, "input capture", icp);
+  printTracking(scenario.name, "pulse count", count);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.5f, (float)icp.maxPct);
+}
+
+void test_timer_wraparound() {
+  // Timer1's 32-bit tick count wraps after ~71 minutes at 1 MHz
+  const Scenario scenario = {"timer wrap", constantRate, 5.0, 0.0, 0.0, 0xFFFFFFFFUL - 2000000UL};
+  const TrackingError icp = trackingError(runInputCapture(scenario), 0.5, 5.0, 1.0);
+  printTracking(scenario.name, "input capture", icp);
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.5f, (float)icp.maxPct);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_extend_timer_count);
+  RUN_TEST(test_edge_recorder_rejects_chatter);
+  RUN_TEST(test_constant_speed);
+  RUN_TEST(test_acceleration_ramp);
+  RUN_TEST(test_speed_step_latency);
+  RUN_TEST(test_edge_jitter);
+  RUN_TEST(test_sensor_bounce);
+  RUN_TEST(test_stop_times_out_to_zero);
+  RUN_TEST(test_slow_speed_resolution);
+  RUN_TEST(test_timer_wraparound);
+  return UNITY_END();
+}
@@ -0,0 +1,291 @@
+/**
+ * @file can_load_gen.cpp
+ * @brief SocketCAN Load Generator for Soak-testing the CAN Ingest Path
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * Usage:
+ *   can_load_gen [--iface vcan0] [--bitrate 1000000] [--load PCT | --rate FPS]
+ *                [--mix speed:10,rpm:10,bg:80] [--bg-ids 0x200-0x2FF]
+ *                [--duration SECONDS]
+ *
+ * Sends a weighted mix of 0x123 (speed, byte 0 = km/h sweeping 0..120),
+ * 0x124 (wheel RPM, little-endian float) and background IDs at a fixed
+ * frame rate. --load converts a bus load percentage into a frame rate using
+ * the nominal size of a classic 8-byte standard frame (111 bits, no stuff
+ * bits), so --load 100 at 1 Mbit/s is ~9000 frames/s, slightly above what a
+ * real bus can carry. vcan has no bitrate; the generator paces itself.
+ *
+ * Bytes 4..7 of every frame carry a per-ID sequence number. The last line
+ * is machine-readable ("RESULT key=value ...") for tools/can_soak.sh.
+ */
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int FRAME_BITS = 111;         // 8-byte standard data frame incl. IFS, no stuffing
+constexpr double TICK_NS = 200000.0;    // Pacing granularity
+
+struct Options {
+    std::string iface = "vcan0";
+    double bitrate = 1000000.0;
+    double loadPercent = 50.0;
+    double rate = 0.0;                  // Frames/s; overrides loadPercent when > 0
+    double duration = 10.0;
+    unsigned speedWeight = 10;
+    unsigned rpmWeight = 10;
+    unsigned bgWeight = 80;
+    uint32_t bgFirst = 0x200;
+    uint32_t bgLast = 0x2FF;
+};
+
+struct Counters {
+    uint64_t speed = 0;
+    uint64_t rpm = 0;
+    uint64_t background = 0;
+    uint64_t txRetries = 0;             // ENOBUFS: qdisc/driver queue full
+};
+
+int64_t monotonicNs()
+{
+    struct timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+void usage()
+{
+    std::fprintf(stderr,
+        "usage: can_load_gen [--iface vcan0] [--bitrate BPS] [--load PCT | --rate FPS]\n"
+        "                    [--mix speed:W,rpm:W,bg:W] [--bg-ids FIRST-LAST] [--duration S]\n");
+}
+
+bool parseMix(const char *text, Options &options)
+{
+    std::string mix(text);
+    size_t start = 0;
+    while (start < mix.size()) {
+        size_t end = mix.find(',', start);
+        if (end == std::string::npos) {
+            end = mix.size();
+        }
+        const std::string item = mix.substr(start, end - start);
+        const size_t colon = item.find(':');
+        if (colon == std::string::npos) {
+            return false;
+        }
+        const std::string name = item.substr(0, colon);
+        const unsigned weight = static_cast<unsigned>(std::strtoul(item.c_str() + colon + 1, nullptr, 10));
+        if (name == "speed") {
+            options.speedWeight = weight;
+        } else if (name == "rpm") {
+            options.rpmWeight = weight;
+        } else if (name == "bg") {
+            options.bgWeight = weight;
+        } else {
+            return false;
+        }
+        start = end + 1;
+    }
+    return options.speedWeight + options.rpmWeight + options.bgWeight > 0;
+}
+
+bool parseArgs(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!value) {
+            return false;
+        }
+        if (std::strcmp(arg, "--iface") == 0) {
+            options.iface = value;
+        } else if (std::strcmp(arg, "--bitrate") == 0) {
+            options.bitrate = std::atof(value);
+        } else if (std::strcmp(arg, "--load") == 0) {
+            options.loadPercent = std::atof(value);
+        } else if (std::strcmp(arg, "--rate") == 0) {
+            options.rate = std::atof(value);
+        } else if (std::strcmp(arg, "--duration") == 0) {
+            options.duration = std::atof(value);
+        } else if (std::strcmp(arg, "--mix") == 0) {
+            if (!parseMix(value, options)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--bg-ids") == 0) {
+            char *dash = nullptr;
+            options.bgFirst = static_cast<uint32_t>(std::strtoul(value, &dash, 0));
+            options.bgLast = (dash && *dash == '-')
+                ? static_cast<uint32_t>(std::strtoul(dash + 1, nullptr, 0)) : options.bgFirst;
+            if (options.bgLast < options.bgFirst || options.bgLast > CAN_SFF_MASK) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+        ++i;
+    }
+    return options.duration > 0.0;
+}
+
+int openSocket(const std::string &iface)
+{
+    const int fd = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0) {
+        std::perror("socket");
+        return -1;
+    }
+
+    struct ifreq ifr;
+    std::memset(&ifr, 0, sizeof(ifr));
+    std::strncpy(ifr.ifr_name, iface.c_str(), IFNAMSIZ - 1);
+    if (::ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        std::fprintf(stderr, "%s: no such interface (sudo ip link add dev %s type vcan && "
+                     "sudo ip link set up %s)\n", iface.c_str(), iface.c_str(), iface.c_str());
+        ::close(fd);
+        return -1;
+    }
+
+    // Send only: an unread receive queue would just collect our own loopback.
+    ::setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, nullptr, 0);
+
+    struct sockaddr_can addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        std::perror("bind");
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+enum class FrameKind { Speed, Rpm, Background };
+
+FrameKind buildFrame(uint64_t index, double elapsedS, const Options &options,
+                     const Counters &counters, struct can_frame &frame)
+{
+    std::memset(&frame, 0, sizeof(frame));
+    frame.can_dlc = 8;
+
+    // Deterministic weighted round-robin over one period of the mix.
+    const unsigned period = options.speedWeight + options.rpmWeight + options.bgWeight;
+    const unsigned slot = static_cast<unsigned>(index % period);
+    FrameKind kind = FrameKind::Background;
+    uint32_t sequence = static_cast<uint32_t>(counters.background);
+    if (slot < options.speedWeight) {
+        // 0..120..0 km/h triangle over 10 s
+        const double phase = std::fmod(elapsedS, 10.0) / 5.0;
+        const double kmh = 120.0 * (phase < 1.0 ? phase : 2.0 - phase);
+        frame.can_id = 0x123;
+        frame.data[0] = static_cast<uint8_t>(std::lround(kmh));
+        kind = FrameKind::Speed;
+        sequence = static_cast<uint32_t>(counters.speed);
+    } else if (slot < options.speedWeight + options.rpmWeight) {
+        const float rpm = static_cast<float>(500.0 + 400.0 * std::sin(elapsedS));
+        frame.can_id = 0x124;
+        std::memcpy(frame.data, &rpm, sizeof(rpm));
+        kind = FrameKind::Rpm;
+        sequence = static_cast<uint32_t>(counters.rpm);
+    } else {
+        const uint32_t span = options.bgLast - options.bgFirst + 1;
+        frame.can_id = options.bgFirst + static_cast<uint32_t>(counters.background % span);
+    }
+    std::memcpy(frame.data + 4, &sequence, sizeof(sequence));
+    return kind;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    const double rate = options.rate > 0.0
+        ? options.rate
+        : options.bitrate * options.loadPercent / 100.0 / FRAME_BITS;
+    if (rate <= 0.0) {
+        usage();
+        return 2;
+    }
+
+    const int fd = openSocket(options.iface);
+    if (fd < 0) {
+        return 1;
+    }
+
+    std::printf("can_load_gen: %s, %.0f frames/s (%.1f %% of %.0f bit/s), mix speed:%u rpm:%u bg:%u, "
+                "%.1f s\n", options.iface.c_str(), rate, rate * FRAME_BITS * 100.0 / options.bitrate,
+                options.bitrate, options.speedWeight, options.rpmWeight, options.bgWeight,
+                options.duration);
+    std::fflush(stdout);
+
+    Counters counters;
+    uint64_t sent = 0;
+    const int64_t startNs = monotonicNs();
+    const int64_t endNs = startNs + static_cast<int64_t>(options.duration * 1e9);
+    struct timespec tick = {0, static_cast<long>(TICK_NS)};
+
+    for (int64_t nowNs = startNs; nowNs < endNs; nowNs = monotonicNs()) {
+        // Catch up to the schedule, then sleep one tick.
+        const double elapsedS = (nowNs - startNs) / 1e9;
+        const uint64_t due = static_cast<uint64_t>(elapsedS * rate);
+        while (sent < due) {
+            struct can_frame frame;
+            const FrameKind kind = buildFrame(sent, elapsedS, options, counters, frame);
+            if (::write(fd, &frame, sizeof(frame)) == static_cast<ssize_t>(sizeof(frame))) {
+                ++sent;
+                ++(kind == FrameKind::Speed ? counters.speed
+                   : kind == FrameKind::Rpm ? counters.rpm : counters.background);
+                continue;
+            }
+            if (errno != ENOBUFS && errno != EAGAIN && errno != EINTR) {
+                std::perror("write");
+                ::close(fd);
+                return 1;
+            }
+            // Queue full: the same frame is retried after a tick.
+            ++counters.txRetries;
+            break;
+        }
+        ::nanosleep(&tick, nullptr);
+    }
+
+    const double seconds = (monotonicNs() - startNs) / 1e9;
+    const double fps = sent / seconds;
+    std::printf("sent %llu frames in %.2f s: %.0f frames/s, %.1f %% bus load, %llu tx retries\n",
+                static_cast<unsigned long long>(sent), seconds, fps,
+                fps * FRAME_BITS * 100.0 / options.bitrate,
+                static_cast<unsigned long long>(counters.txRetries));
+    std::printf("RESULT sent=%llu speed=%llu rpm=%llu bg=%llu seconds=%.3f fps=%.0f load_pct=%.1f "
+                "tx_retries=%llu\n",
+                static_cast<unsigned long long>(sent),
+                static_cast<unsigned long long>(counters.speed),
+                static_cast<unsigned long long>(counters.rpm),
+                static_cast<unsigned long long>(counters.background), seconds, fps,
+                fps * FRAME_BITS * 100.0 / options.bitrate,
+                static_cast<unsigned long long>(counters.txRetries));
+
+    ::close(fd);
+    return 0;
+}
@@ -0,0 +1,304 @@
+/**
+ * @file render_bench.cpp
+ * @brief Offscreen Paint Benchmark for the Cluster Widgets
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * Usage:
+ *   render_bench [--frames N] [--max-cpu PERCENT]
+ *
+ * Runs on the "offscreen" QPA platform (no display needed). Each case -
+ * SpeedometerWidget, RpmGauge, BatteryWidget and the full MainWindow - is
+ * created at its dashboard size and driven by a scripted 60 Hz sweep
+ * (speed 0-30-0 km/h, wheel RPM 0-120-0, battery 100-0 %). Every frame is
+ * stepped with advance() and painted with QWidget::render() into an image.
+ *
+ * Reported per case: paint time p50/p99/mean, frames per second achievable
+ * (drive + paint), CPU share of one core at 60 FPS, and heap allocations
+ * and bytes per frame (glibc malloc interposition, covers operator new and
+ * Qt's own containers).
+ *
+ * render() repaints the whole widget, so the numbers are an upper bound on
+ * what the partial update() regions cost on the Pi. With --max-cpu the
+ * exit code is 1 when any case exceeds the budget (the spec asks for
+ * < 20 % CPU at 60 FPS).
+ */
+
+#include "MainWindow.h"
+#include "ReplaySource.h"
+#include "SpeedometerWidget.h"
+#include "RpmGauge.h"
+#include "BatteryWidget.h"
+
+#include <QApplication>
+#include <QImage>
+#include <QList>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Allocation counting
+// ---------------------------------------------------------------------------
+
+namespace {
+std::atomic<bool> g_countAllocations(false);
+std::atomic<unsigned long long> g_allocations(0);
+std::atomic<unsigned long long> g_allocatedBytes(0);
+
+inline void countAllocation(size_t bytes)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed)) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+}  // namespace
+
+#if defined(__GLIBC__)
+#define RENDER_BENCH_COUNTS_ALLOCATIONS 1
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+// The executable's definitions take precedence over libc for Qt as well.
+void *malloc(size_t size)
+{
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    countAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+}
+#else
+#define RENDER_BENCH_COUNTS_ALLOCATIONS 0
+#endif
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr float FRAME_DT = 1.0f / 60.0f;
+constexpr int WARMUP_FRAMES = 60;
+
+struct Sweep {
+    float speedKmh;
+    float rpm;
+    float batteryPercent;
+    float batteryVoltage;
+};
+
+// Triangle wave in [0, 1] with the given period in frames.
+float triangle(int frame, int period)
+{
+    const float phase = static_cast<float>(frame % period) / period;
+    return phase < 0.5f ? phase * 2.0f : (1.0f - phase) * 2.0f;
+}
+
+Sweep sweepAt(int frame, int totalFrames)
+{
+    Sweep s;
+    s.speedKmh = 30.0f * triangle(frame, 240);   // 4 s up and down
+    s.rpm = 120.0f * triangle(frame + 60, 180);  // Out of phase with speed
+    const float drain = static_cast<float>(frame) / qMax(1, totalFrames - 1);
+    s.batteryPercent = 100.0f * (1.0f - drain);
+    s.batteryVoltage = 8.4f - 2.0f * drain;
+    return s;
+}
+
+struct CaseResult {
+    const char *name;
+    std::vector<long long> paintNs;
+    long long totalFrameNs = 0;
+    unsigned long long allocations = 0;
+    unsigned long long allocatedBytes = 0;
+};
+
+using DriveFn = std::function<void(const Sweep &)>;
+
+CaseResult runCase(const char *name, QWidget *target, int frames, const DriveFn &drive)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const qreal dpr = target->devicePixelRatioF();
+    QImage image(target->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+
+    // Warm-up fills static-layer caches and glyph caches like a running cluster.
+    for (int i = 0; i < WARMUP_FRAMES; ++i) {
+        drive(sweepAt(i, frames));
+        target->render(&image);
+    }
+
+    CaseResult result;
+    result.name = name;
+    result.paintNs.reserve(frames);
+
+    g_allocations.store(0);
+    g_allocatedBytes.store(0);
+    for (int i = 0; i < frames; ++i) {
+        const Sweep sweep = sweepAt(i, frames);
+
+        g_countAllocations.store(true, std::memory_order_relaxed);
+        const Clock::time_point frameStart = Clock::now();
+        drive(sweep);
+        const Clock::time_point paintStart = Clock::now();
+        target->render(&image);
+        const Clock::time_point paintEnd = Clock::now();
+        g_countAllocations.store(false, std::memory_order_relaxed);
+
+        result.paintNs.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(paintEnd - paintStart).count());
+        result.totalFrameNs +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(paintEnd - frameStart).count();
+    }
+    result.allocations = g_allocations.load();
+    result.allocatedBytes = g_allocatedBytes.load();
+    return result;
+}
+
+long long percentile(std::vector<long long> values, double fraction)
+{
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t index = std::min(values.size() - 1,
+                                  static_cast<size_t>(fraction * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+// Drops qDebug chatter from the dashboard classes; warnings still go through.
+void quietMessageHandler(QtMsgType type, const QMessageLogContext &, const QString &message)
+{
+    if (type == QtDebugMsg || type == QtInfoMsg) {
+        return;
+    }
+    std::fprintf(stderr, "%s\n", qPrintable(message));
+}
+
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+    int frames = 1200;
+    double maxCpuPercent = 0.0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = qMax(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--max-cpu") == 0 && i + 1 < argc) {
+            maxCpuPercent = std::atof(argv[++i]);
+        } else if (argv[i][0] == '-' && argv[i][1] == '-') {
+            // Leave Qt's own options (-platform, ...) to QApplication.
+            std::fprintf(stderr, "usage: %s [--frames N] [--max-cpu PERCENT]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    qInstallMessageHandler(quietMessageHandler);
+    QApplication app(argc, argv);
+
+    std::vector<CaseResult> results;
+
+    {
+        SpeedometerWidget widget;
+        widget.setFixedSize(520, 340);
+        results.push_back(runCase("speedometer", &widget, frames, [&](const Sweep &s) {
+            widget.setSpeed(s.speedKmh);
+            widget.advance(FRAME_DT);
+        }));
+    }
+    {
+        RpmGauge widget;
+        widget.setFixedSize(236, 192);
+        results.push_back(runCase("rpm_gauge", &widget, frames, [&](const Sweep &s) {
+            widget.setRPM(s.rpm);
+            widget.advance(FRAME_DT);
+        }));
+    }
+    {
+        BatteryWidget widget;
+        widget.setFixedSize(220, 88);
+        results.push_back(runCase("battery", &widget, frames, [&](const Sweep &s) {
+            widget.setBattery(s.batteryPercent, s.batteryVoltage);
+        }));
+    }
+    {
+        // The event loop never runs, so the staged telemetry bring-up stays
+        // queued and no CAN socket, sampler or bridge is started.
+        MainWindow window{ReplayOptions()};
+        window.show();
+        SpeedometerWidget *speedometer = window.findChild<SpeedometerWidget *>();
+        RpmGauge *rpmGauge = window.findChild<RpmGauge *>();
+        BatteryWidget *battery = window.findChild<BatteryWidget *>();
+        if (!speedometer || !rpmGauge || !battery) {
+            std::fprintf(stderr, "MainWindow layout is missing a cluster widget\n");
+            return 1;
+        }
+        results.push_back(runCase("main_window", &window, frames, [&](const Sweep &s) {
+            speedometer->setSpeed(s.speedKmh);
+            rpmGauge->setRPM(s.rpm);
+            battery->setBattery(s.batteryPercent, s.batteryVoltage);
+            speedometer->advance(FRAME_DT);
+            rpmGauge->advance(FRAME_DT);
+        }));
+    }
+
+    std::printf("render_bench: %d frames per case, 60 Hz sweep, QPA %s\n",
+                frames, qPrintable(QGuiApplication::platformName()));
+    std::printf("%-12s %9s %9s %9s %9s %8s %10s %10s\n",
+                "case", "p50 us", "p99 us", "mean us", "max fps", "cpu@60", "allocs/f", "KiB/f");
+
+    bool withinBudget = true;
+    for (const CaseResult &r : results) {
+        long long paintTotalNs = 0;
+        for (long long ns : r.paintNs) {
+            paintTotalNs += ns;
+        }
+        const double meanPaintUs = paintTotalNs / 1000.0 / frames;
+        const double meanFrameNs = static_cast<double>(r.totalFrameNs) / frames;
+        const double maxFps = meanFrameNs > 0.0 ? 1e9 / meanFrameNs : 0.0;
+        const double cpuAt60 = meanFrameNs * 60.0 / 1e9 * 100.0;
+
+        std::printf("%-12s %9.1f %9.1f %9.1f %9.0f %7.1f%%",
+                    r.name, percentile(r.paintNs, 0.50) / 1000.0,
+                    percentile(r.paintNs, 0.99) / 1000.0, meanPaintUs, maxFps, cpuAt60);
+        if (RENDER_BENCH_COUNTS_ALLOCATIONS) {
+            std::printf(" %10.1f %10.2f\n", static_cast<double>(r.allocations) / frames,
+                        r.allocatedBytes / 1024.0 / frames);
+        } else {
+            std::printf(" %10s %10s\n", "n/a", "n/a");
+        }
+
+        if (maxCpuPercent > 0.0 && cpuAt60 > maxCpuPercent) {
+            withinBudget = false;
+        }
+    }
+
+    if (maxCpuPercent > 0.0) {
+        std::printf("%s: CPU budget %.1f%% at 60 FPS\n", withinBudget ? "PASS" : "FAIL",
+                    maxCpuPercent);
+    }
+    return withinBudget ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file soc_bench.cpp
+ * @brief SocEstimator Benchmark on Recorded Battery Traces
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * Usage:
+ *   soc_bench [trace.csv ...]
+ *
+ * Trace format: one sample per line, "time_s,voltage_v,current_ma"
+ * (header lines and lines starting with '#' are skipped). Without
+ * arguments a synthetic 10-minute 100 Hz discharge trace is used.
+ *
+ * Reports ns/update for SocEstimator and for a direct float port of the
+ * bridge's BatteryMonitor (sorted-copy median + linear OCV scan), and the
+ * final SOC of both.
+ */
+
+#include "SocEstimator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct TraceSample {
+    double timeS;
+    float voltage;
+    float currentMa;
+};
+
+// Straight port of BatteryMonitor.update() from piracer_bridge.py.
+class ReferenceMonitor
+{
+public:
+    float update(float voltage, double now)
+    {
+        m_history.push_back(voltage);
+        if (m_history.size() > 7) {
+            m_history.pop_front();
+        }
+        std::vector<float> sorted(m_history.begin(), m_history.end());
+        std::sort(sorted.begin(), sorted.end());
+        const size_t n = sorted.size();
+        const float stable = (n % 2) ? sorted[n / 2] : 0.5f * (sorted[n / 2 - 1] + sorted[n / 2]);
+
+        if (!m_initialized) {
+            m_soc = ocv(stable);
+            m_last = now;
+            m_initialized = true;
+            return m_soc;
+        }
+        const double dt = std::max(0.05, now - m_last);
+        m_last = now;
+        const float target = std::min(100.0f, std::max(0.0f, ocv(stable)));
+        const float prev = m_soc;
+        float smoothed = 0.12f * target + 0.88f * prev;
+        const float delta = smoothed - prev;
+        if (delta > 2.0 * dt) {
+            smoothed = prev + 2.0f * static_cast<float>(dt);
+        } else if (delta < -3.0 * dt) {
+            smoothed = prev - 3.0f * static_cast<float>(dt);
+        }
+        m_soc = smoothed;
+        return m_soc;
+    }
+
+private:
+    static float ocv(float voltage)
+    {
+        static const float table[][2] = {
+            {4.20f, 100.0f}, {4.12f, 90.0f}, {4.04f, 80.0f}, {3.98f, 70.0f},
+            {3.92f, 60.0f}, {3.86f, 50.0f}, {3.80f, 40.0f}, {3.74f, 30.0f},
+            {3.68f, 20.0f}, {3.55f, 10.0f}, {3.30f, 0.0f},
+        };
+        const int cells = voltage >= 10.0f ? 3 : (voltage >= 6.0f ? 2 : 1);
+        const float cell = voltage / cells;
+        for (int i = 0; i < 10; ++i) {
+            if (cell >= table[i][0]) {
+                return table[i][1];
+            }
+            if (cell >= table[i + 1][0]) {
+                const float ratio = (cell - table[i + 1][0]) / (table[i][0] - table[i + 1][0]);
+                return table[i + 1][1] + ratio * (table[i][1] - table[i + 1][1]);
+            }
+        }
+        return 0.0f;
+    }
+
+    std::deque<float> m_history;
+    bool m_initialized = false;
+    float m_soc = 100.0f;
+    double m_last = 0.0;
+};
+
+std::vector<TraceSample> loadTrace(const char *path)
+{
+    std::vector<TraceSample> trace;
+    FILE *file = std::fopen(path, "r");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return trace;
+    }
+    char line[256];
+    while (std::fgets(line, sizeof(line), file)) {
+        if (line[0] == '#') {
+            continue;
+        }
+        TraceSample sample;
+        if (std::sscanf(line, "%lf,%f,%f", &sample.timeS, &sample.voltage, &sample.currentMa) == 3) {
+            trace.push_back(sample);
+        }
+    }
+    std::fclose(file);
+    return trace;
+}
+
+std::vector<TraceSample> syntheticTrace()
+{
+    // 2S pack under a pulsing 1-3 A load with occasional sag spikes.
+    std::vector<TraceSample> trace;
+    const int samples = 10 * 60 * 100;
+    unsigned seed = 12345;
+    for (int i = 0; i < samples; ++i) {
+        const double t = i * 0.01;
+        seed = seed * 1103515245u + 12345u;
+        const float noise = ((seed >> 16) & 0xFF) / 255.0f - 0.5f;
+        const float current = 2000.0f + 1000.0f * std::sin(static_cast<float>(t) * 0.7f);
+        float voltage = 8.3f - 0.9f * static_cast<float>(t / 600.0) - current * 0.00008f
+                        + noise * 0.02f;
+        if (i % 997 == 0) {
+            voltage -= 0.5f;   // Motor start sag
+        }
+        trace.push_back({t, voltage, current});
+    }
+    return trace;
+}
+
+void runTrace(const char *name, const std::vector<TraceSample> &trace)
+{
+    if (trace.empty()) {
+        return;
+    }
+    constexpr int REPEATS = 20;
+    using Clock = std::chrono::steady_clock;
+
+    float estimatorSoc = 0.0f;
+    const auto estimatorStart = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        SocEstimator estimator;
+        for (const TraceSample &s : trace) {
+            estimatorSoc = estimator.update(s.voltage, s.currentMa,
+                                            static_cast<qint64>(s.timeS * 1e9));
+        }
+    }
+    const double estimatorNs =
+        std::chrono::duration<double, std::nano>(Clock::now() - estimatorStart).count();
+
+    float referenceSoc = 0.0f;
+    const auto referenceStart = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        ReferenceMonitor reference;
+        for (const TraceSample &s : trace) {
+            referenceSoc = reference.update(s.voltage, s.timeS);
+        }
+    }
+    const double referenceNs =
+        std::chrono::duration<double, std::nano>(Clock::now() - referenceStart).count();
+
+    const double updates = static_cast<double>(trace.size()) * REPEATS;
+    std::printf("%s: %zu samples, %.1f s\n", name, trace.size(),
+                trace.back().timeS - trace.front().timeS);
+    std::printf("  SocEstimator     %7.1f ns/update  final SOC %6.2f %%\n",
+                estimatorNs / updates, estimatorSoc);
+    std::printf("  float reference  %7.1f ns/update  final SOC %6.2f %% (no coulomb counting)\n",
+                referenceNs / updates, referenceSoc);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        runTrace("synthetic", syntheticTrace());
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        runTrace(argv[i], loadTrace(argv[i]));
+    }
+    return 0;
+}
@@ -24,9 +24,28 @@ SOURCES += \
     src/widgets/SpeedometerWidget.cpp \
     src/widgets/RpmGauge.cpp \
     src/widgets/BatteryWidget.cpp \
+    src/widgets/LatencyOverlay.cpp \
     src/serial/SerialReader.cpp \
+    src/serial/ReplaySource.cpp \
+    src/serial/CanIngestThread.cpp \
+    src/serial/CanBatchReceiver.cpp \
+    src/serial/CanBusDiagnostics.cpp \
+    src/serial/CanLinkMonitor.cpp \
+    src/serial/TelemetrySocket.cpp \
+    src/serial/Ina219Device.cpp \
+    src/serial/Ina219Sampler.cpp \
     src/utils/DataProcessor.cpp \
-    src/utils/CalibrationManager.cpp
+    src/utils/CalibrationManager.cpp \
+    src/utils/CanSignalDecoder.cpp \
+    src/utils/DriveModeSource.cpp \
+    src/utils/FrameScheduler.cpp \
+    src/utils/LatencyHistogram.cpp \
+    src/utils/LatencyTracer.cpp \
+    src/utils/NeedleDynamics.cpp \
+    src/utils/SocEstimator.cpp \
+    src/utils/StartupTimeline.cpp \
+    src/utils/TelemetryRecorder.cpp \
+    src/utils/UnixSignalNotifier.cpp
 
 # Header files
 HEADERS += \
@@ -34,9 +53,31 @@ HEADERS += \
     src/widgets/SpeedometerWidget.h \
     src/widgets/RpmGauge.h \
     src/widgets/BatteryWidget.h \
+    src/widgets/LatencyOverlay.h \
     src/serial/SerialReader.h \
+    src/serial/ReplaySource.h \
+    src/serial/CanIngestThread.h \
+    src/serial/CanBatchReceiver.h \
+    src/serial/CanBusDiagnostics.h \
+    src/serial/CanLinkMonitor.h \
+    src/serial/TelemetryPacket.h \
+    src/serial/TelemetrySocket.h \
+    src/serial/Ina219Device.h \
+    src/serial/Ina219Sampler.h \
     src/utils/DataProcessor.h \
-    src/utils/CalibrationManager.h
+    src/utils/CalibrationManager.h \
+    src/utils/CanSignalDecoder.h \
+    src/utils/DriveModeSource.h \
+    src/utils/FrameScheduler.h \
+    src/utils/LatencyHistogram.h \
+    src/utils/LatencyTracer.h \
+    src/utils/NeedleDynamics.h \
+    src/utils/SocEstimator.h \
+    src/utils/SpscRing.h \
+    src/utils/StartupTimeline.h \
+    src/utils/TelemetryRecord.h \
+    src/utils/TelemetryRecorder.h \
+    src/utils/UnixSignalNotifier.h
 
 # Resources
 RESOURCES += \
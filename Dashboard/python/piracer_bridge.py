@@ -17,6 +17,7 @@ import sys
 import time
 import struct
 import fcntl
+import socket
 from enum import Enum
 from collections import deque
 from statistics import median
@@ -137,6 +138,51 @@ class BatteryMonitor:
         return self.soc_percent
 
 
+class TelemetryWriter:
+    """
+    Sends fixed-layout binary telemetry datagrams to the dashboard.
+
+    Layout must match Dashboard/src/serial/TelemetryPacket.h (48 bytes, LE).
+    """
+
+    MAGIC = 0x4D545250  # "PRTM"
+    VERSION = 1
+    FORMAT = struct.Struct("<IHHIIqffffB7x")
+    FLAG_SIMULATED = 1 << 0
+
+    def __init__(self, socket_path: str):
+        self.socket_path = socket_path
+        self.sequence = 0
+        self.dropped = 0
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        self.sock.setblocking(False)
+
+    def send(self, data: Dict, simulated: bool = False) -> bool:
+        battery = data.get("battery", {})
+        direction = str(data.get("direction", "N"))[:1] or "N"
+        self.sequence = (self.sequence + 1) & 0xFFFFFFFF
+        packet = self.FORMAT.pack(
+            self.MAGIC,
+            self.VERSION,
+            self.FORMAT.size,
+            self.sequence,
+            self.FLAG_SIMULATED if simulated else 0,
+            time.time_ns(),
+            float(battery.get("voltage", 0.0)),
+            float(battery.get("current", 0.0)),
+            float(battery.get("power", 0.0)),
+            float(battery.get("percent", 0.0)),
+            ord(direction),
+        )
+        try:
+            self.sock.sendto(packet, self.socket_path)
+            return True
+        except (BlockingIOError, FileNotFoundError, ConnectionRefusedError):
+            # Dashboard not listening or its queue is full: drop, never block.
+            self.dropped += 1
+            return False
+
+
 class DriveMode(Enum):
     NEUTRAL = "N"
     DRIVE = "F"
@@ -159,14 +205,16 @@ class PiRacerBridge:
     SPEED_CAN_ID = 0x123
     DRIVE_MODE_SNAPSHOT_PATH = "/tmp/piracer_drive_mode.json"
     
-    def __init__(self, vehicle_type: str = "standard"):
+    def __init__(self, vehicle_type: str = "standard", telemetry_writer: Optional[TelemetryWriter] = None):
         """
         PiRacer 브릿지 초기화
         
         Args:
             vehicle_type: "standard" 또는 "pro"
+            telemetry_writer: binary datagram writer (None = JSON on stdout)
         """
         self.vehicle_type = vehicle_type
+        self.telemetry_writer = telemetry_writer
         self.piracer: Optional[PiRacerStandard] = None
         self.last_throttle = 0.0
         self.can_bus = None
@@ -242,10 +290,13 @@ class PiRacerBridge:
                 break
 
             if msg.arbitration_id == self.SPEED_CAN_ID and len(msg.data) >= 1:
-                # 포맷 1) 1바이트 정수 속도(km/h) - 현재 candump 포맷
-                # 예: 11 00 00 00 ... -> 17 km/h
-                if len(msg.data) >= 4 and msg.data[1] == 0 and msg.data[2] == 0 and msg.data[3] == 0:
-                    self.last_can_speed_kmh = float(int(msg.data[0]))
+                # 포맷 1) km/h x 256 big-endian + 롤링 카운터 (ADUINO uno_can)
+                # 예: 11 80 2A 00 ... -> 17.5 km/h, 카운터 42
+                # 1바이트 정수 속도(11 00 00 00 ...)도 byte 1 = 0 이므로 같은 규칙으로 해석됨
+                # float 포맷은 byte 3(지수)이 0이 아니므로 byte 3 = 0 으로 구분
+                if len(msg.data) < 4 or msg.data[3] == 0:
+                    fraction = msg.data[1] if len(msg.data) >= 2 else 0
+                    self.last_can_speed_kmh = msg.data[0] + fraction / 256.0
                     result["speed_kmh"] = self.last_can_speed_kmh
                 elif len(msg.data) >= 4:
                     # 포맷 2) 4바이트 float 속도(km/h)
@@ -430,16 +481,24 @@ class PiRacerBridge:
         print("PiRacer Bridge started", file=sys.stderr)
         print(f"Update interval: {self.UPDATE_INTERVAL}s", file=sys.stderr)
         print(f"Vehicle type: {self.vehicle_type}", file=sys.stderr)
+        if self.telemetry_writer is not None:
+            print(f"Transport: uds ({self.telemetry_writer.socket_path})", file=sys.stderr)
+        else:
+            print("Transport: json (stdout)", file=sys.stderr)
         print("-" * 50, file=sys.stderr)
         
         try:
             while True:
                 data = self.read_piracer_data()
                 
-                # JSON 형식으로 stdout에 출력 (Qt가 읽음)
-                json_output = json.dumps(data)
-                print(json_output)
-                sys.stdout.flush()  # 버퍼 즉시 플러시
+                if self.telemetry_writer is not None:
+                    # Binary datagram, no JSON parsing on the Qt side
+                    self.telemetry_writer.send(data, simulated=self.piracer is None)
+                else:
+                    # JSON 형식으로 stdout에 출력 (Qt가 읽음)
+                    json_output = json.dumps(data)
+                    print(json_output)
+                    sys.stdout.flush()  # 버퍼 즉시 플러시
                 
                 time.sleep(self.UPDATE_INTERVAL)
         
@@ -469,10 +528,22 @@ def main():
         default=0.5,
         help="Update interval in seconds (default: 0.5)"
     )
+    parser.add_argument(
+        "--transport",
+        choices=["json", "uds"],
+        default="json",
+        help="json = JSON lines on stdout, uds = binary datagrams (default: json)"
+    )
+    parser.add_argument(
+        "--socket",
+        default="/tmp/piracer_telemetry.sock",
+        help="Dashboard telemetry socket for --transport uds"
+    )
     
     args = parser.parse_args()
     
-    bridge = PiRacerBridge(vehicle_type=args.type)
+    writer = TelemetryWriter(args.socket) if args.transport == "uds" else None
+    bridge = PiRacerBridge(vehicle_type=args.type, telemetry_writer=writer)
     bridge.UPDATE_INTERVAL = args.interval
     
     bridge.run()
@@ -11,6 +11,18 @@
 #include "BatteryWidget.h"
 #include "SerialReader.h"
 #include "DataProcessor.h"
+#include "DriveModeSource.h"
+#include "FrameScheduler.h"
+#include "CalibrationManager.h"
+#include "TelemetrySocket.h"
+#include "Ina219Sampler.h"
+#include "SocEstimator.h"
+#include "StartupTimeline.h"
+#include "LatencyTracer.h"
+#include "LatencyOverlay.h"
+#include "UnixSignalNotifier.h"
+#include "TelemetryRecorder.h"
+#include "ReplaySource.h"
 
 #include <QDateTime>
 #include <QCoreApplication>
@@ -23,9 +35,13 @@
 #include <QParallelAnimationGroup>
 #include <QPropertyAnimation>
 #include <QEasingCurve>
+#include <QStyle>
+#include <QPaintEvent>
+#include <QShortcut>
+#include <csignal>
 #include <QDebug>
 
-MainWindow::MainWindow(QWidget *parent)
+MainWindow::MainWindow(const ReplayOptions &replay, QWidget *parent)
     : QMainWindow(parent)
     , m_speedometer(nullptr)
     , m_rpmGauge(nullptr)
@@ -39,28 +55,71 @@ MainWindow::MainWindow(QWidget *parent)
     , m_serialReader(nullptr)
     , m_pythonProcess(nullptr)
     , m_dataProcessor(nullptr)
+    , m_driveModeSource(nullptr)
+    , m_frameScheduler(nullptr)
+    , m_telemetrySocket(nullptr)
+    , m_batterySampler(nullptr)
+    , m_socEstimator(nullptr)
+    , m_recorder(nullptr)
+    , m_replaySource(nullptr)
+    , m_telemetryConfig(nullptr)
+    , m_firstFramePainted(false)
     , m_maxSpeed(0.0f)
     , m_currentSpeed(0.0f)
+    , m_lastCanRpmTime(0)
     , m_driveDirection("N")
+    , m_pendingSpeed(0.0f)
+    , m_pendingRpm(0.0f)
+    , m_pendingBatteryPercent(0.0f)
+    , m_pendingBatteryVoltage(0.0f)
+    , m_pendingSpeedTrace(0)
+    , m_speedPending(false)
+    , m_rpmPending(false)
+    , m_batteryPending(false)
     , m_lastCenterMode("")
     , m_centerModeOpacity(nullptr)
     , m_centerModeAnim(nullptr)
     , m_elapsedTimer(nullptr)
     , m_startTime(0)
+    , m_maxSpeedPulseTimer(nullptr)
+    , m_restyleCount(0)
+    , m_restyleCountAtLastTick(0)
+    , m_restylesPerSecond(0)
+    , m_latencyOverlay(nullptr)
+    , m_dumpSignal(nullptr)
 {
     // Set fixed window size
     setFixedSize(WINDOW_WIDTH, WINDOW_HEIGHT);
     setWindowTitle("PiRacer Dashboard");
     
+    // Config is read once here and shared; components no longer probe for it.
+    CalibrationManager config;
+    const QString configPath = CalibrationManager::findConfigFile();
+    if (configPath.isEmpty() || !config.load(configPath)) {
+        qWarning() << "Using default calibration values";
+    }
+    
     // Initialize components
     m_dataProcessor = new DataProcessor(this);
-    m_serialReader = new SerialReader(this);
+    m_dataProcessor->applyCalibration(config);
+    m_serialReader = new SerialReader(config, this);
+    m_driveModeSource = new DriveModeSource(QStringLiteral("/tmp/piracer_drive_mode.json"), this);
+    m_driveDirection = m_driveModeSource->direction();
+    if (replay.isEnabled()) {
+        m_replaySource = new ReplaySource(replay, this);
+    }
+    
+    // One frame clock drives ingest draining, needle motion and repaints.
+    m_frameScheduler = new FrameScheduler(config.displayTargetFps(), this);
+    m_serialReader->setFrameDriven(true);
     
     // Setup UI
     setupUI();
+    m_speedometer->setNeedleResponseTime(config.speedNeedleResponseMs() / 1000.0f);
+    m_rpmGauge->setNeedleResponseTime(config.rpmNeedleResponseMs() / 1000.0f);
     setupConnections();
-    setupPythonBridge();
     applyStyles();
+    setupLatencyDiagnostics(config);
     
     // Start elapsed timer
     m_startTime = QDateTime::currentMSecsSinceEpoch();
@@ -68,11 +127,48 @@ MainWindow::MainWindow(QWidget *parent)
     connect(m_elapsedTimer, &QTimer::timeout, this, &MainWindow::updateElapsedTime);
     m_elapsedTimer->start(1000);  // Update every second
     
+    m_frameScheduler->start();
+    
+    // Staged startup: CAN, INA219 and the bridge come up after the first
+    // frame has been painted (see paintEvent).
+    m_telemetryConfig = new CalibrationManager(config);
+    if (!config.startupStaged()) {
+        startTelemetrySources();
+    }
+    
+    StartupTimeline::instance().mark(StartupTimeline::WindowConstructed);
     qDebug() << "Dashboard initialized successfully";
 }
 
 MainWindow::~MainWindow()
 {
+    if (m_batterySampler) {
+        m_batterySampler->stopAndWait();
+        qDebug() << "INA219 samples:" << m_batterySampler->samplesRead()
+                 << "read errors:" << m_batterySampler->readErrors()
+                 << "ring overflows:" << m_batterySampler->ringOverflows();
+    }
+    delete m_socEstimator;
+    
+    // Every recorder producer must be stopped before the mapping goes away;
+    // the CAN reader (and its ingest thread) is otherwise a later child delete.
+    delete m_serialReader;
+    m_serialReader = nullptr;
+    delete m_recorder;
+    delete m_telemetryConfig;
+    
+    const LatencyHistogram &frames = m_frameScheduler->frameIntervals();
+    if (frames.count() > 0) {
+        qDebug() << "GUI frame interval: frames" << frames.count()
+                 << "p50" << frames.percentileUs(0.50) / 1000.0 << "ms"
+                 << "p99" << frames.percentileUs(0.99) / 1000.0 << "ms"
+                 << "max" << frames.maxUs() / 1000.0 << "ms";
+    }
+    
+    if (LatencyTracer::instance().histogram(LatencyTracer::EndToEnd).count() > 0) {
+        qDebug().noquote() << "CAN rx -> paint latency:\n" + LatencyTracer::instance().report();
+    }
+
     // Cleanup Python process
     if (m_pythonProcess) {
         m_pythonProcess->terminate();
@@ -241,6 +337,47 @@ void MainWindow::setupUI()
     m_forwardLabel->setFixedWidth(54);
     m_parkingLabel->setFixedWidth(104);
     m_backwardLabel->setFixedWidth(54);
+    // Styles are set once; mode changes only flip the "mode" property.
+    const QString hintStyle =
+        "QLabel {"
+        "   background-color: #1A2940;"
+        "   color: #8FA6C2;"
+        "   border: 1px solid #2D4867;"
+        "   border-radius: 8px;"
+        "   font-family: 'Roboto Condensed';"
+        "   font-size: 10pt;"
+        "   font-weight: 600;"
+        "   padding: 2px 2px;"
+        "}";
+    m_forwardLabel->setStyleSheet(hintStyle);
+    m_backwardLabel->setStyleSheet(hintStyle);
+    m_parkingLabel->setProperty("mode", "P");
+    m_parkingLabel->setProperty("stale", !m_driveModeSource->isFresh());
+    m_parkingLabel->setStyleSheet(
+        "QLabel {"
+        "   background-color: #FFD34D;"
+        "   color: #08121F;"
+        "   border: 1px solid #FFD34D;"
+        "   border-radius: 8px;"
+        "   font-family: 'Roboto Condensed';"
+        "   font-size: 18pt;"
+        "   font-weight: 800;"
+        "   padding: 0px 2px;"
+        "}"
+        "QLabel[mode=\"F\"] {"
+        "   background-color: #00FF88;"
+        "   border: 1px solid #00FF88;"
+        "}"
+        "QLabel[mode=\"R\"] {"
+        "   background-color: #FF5B6E;"
+        "   border: 1px solid #FF5B6E;"
+        "}"
+        // Drive-mode snapshot older than 2 s (or missing): mode may be outdated
+        "QLabel[stale=\"true\"] {"
+        "   color: #5A6B80;"
+        "   border-style: dashed;"
+        "}"
+    );
     m_centerModeOpacity = new QGraphicsOpacityEffect(this);
     m_centerModeOpacity->setOpacity(1.0);
     m_parkingLabel->setGraphicsEffect(m_centerModeOpacity);
@@ -294,6 +431,7 @@ void MainWindow::setupUI()
 
     m_maxSpeedLabel = new QLabel("0.0");
     m_maxSpeedLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    m_maxSpeedLabel->setProperty("pulse", false);
     m_maxSpeedLabel->setStyleSheet(
         "QLabel {"
         "   color: #00D4FF;"
@@ -301,7 +439,17 @@ void MainWindow::setupUI()
         "   font-size: 20pt;"
         "   font-weight: bold;"
         "}"
+        "QLabel[pulse=\"true\"] {"
+        "   color: #A7F6FF;"
+        "   font-size: 21pt;"
+        "}"
     );
+    m_maxSpeedPulseTimer = new QTimer(this);
+    m_maxSpeedPulseTimer->setSingleShot(true);
+    connect(m_maxSpeedPulseTimer, &QTimer::timeout, this, [this]() {
+        m_maxSpeedLabel->setProperty("pulse", false);
+        repolish(m_maxSpeedLabel);
+    });
     QLabel *maxUnitLabel = new QLabel("km/h");
     maxUnitLabel->setAlignment(Qt::AlignLeft | Qt::AlignBottom);
     maxUnitLabel->setStyleSheet(
@@ -343,25 +491,251 @@ void MainWindow::setupConnections()
     // Serial data connection
     connect(m_serialReader, &SerialReader::speedDataReceived,
             this, &MainWindow::onSpeedDataReceived);
+    connect(m_serialReader, &SerialReader::rpmDataReceived,
+            this, &MainWindow::onRpmDataReceived);
+    
+    // Drive mode snapshot (X/B/Y), parsed only when the file changes
+    connect(m_driveModeSource, &DriveModeSource::directionChanged,
+            this, &MainWindow::onDriveModeChanged);
+    connect(m_driveModeSource, &DriveModeSource::freshnessChanged,
+            this, &MainWindow::onDriveModeFreshnessChanged);
+    
+    // Frame clock
+    connect(m_frameScheduler, &FrameScheduler::frame,
+            this, &MainWindow::onFrame);
     
     // Reset button
     connect(m_resetButton, &QPushButton::clicked,
             this, &MainWindow::onResetButtonClicked);
 }
 
+void MainWindow::setupLatencyDiagnostics(const CalibrationManager &config)
+{
+    m_latencyDumpPath = config.debugLatencyDumpPath();
+    
+    // Overlay sits over the bottom-left corner, above the dashboard panels.
+    m_latencyOverlay = new LatencyOverlay(this);
+    m_latencyOverlay->setStatusSource([this]() {
+        return m_serialReader->diagnostics().summary()
+             + QStringLiteral("\nrestyles %1/s (total %2)").arg(m_restylesPerSecond).arg(m_restyleCount);
+    });
+    m_latencyOverlay->move(8, WINDOW_HEIGHT - m_latencyOverlay->height() - 8);
+    m_latencyOverlay->raise();
+    m_latencyOverlay->setVisible(config.debugLatencyOverlay());
+    
+    QShortcut *overlayShortcut = new QShortcut(QKeySequence(Qt::Key_F3), this);
+    connect(overlayShortcut, &QShortcut::activated, this, [this]() {
+        m_latencyOverlay->setVisible(!m_latencyOverlay->isVisible());
+    });
+    
+    // kill -USR1 <pid> writes the histogram without stopping the dashboard.
+    m_dumpSignal = new UnixSignalNotifier(SIGUSR1, this);
+    if (m_dumpSignal->isValid()) {
+        connect(m_dumpSignal, &UnixSignalNotifier::activated,
+                this, &MainWindow::dumpLatency);
+    }
+}
+
+void MainWindow::dumpLatency()
+{
+    if (!LatencyTracer::instance().dumpToFile(m_latencyDumpPath)) {
+        return;
+    }
+    // Bus health next to the latency table, to match stalls with bus problems
+    QFile file(m_latencyDumpPath);
+    if (file.open(QIODevice::Append | QIODevice::Text)) {
+        file.write("\n" + m_serialReader->diagnostics().summary().toUtf8() + "\n");
+    }
+}
+
+void MainWindow::paintEvent(QPaintEvent *event)
+{
+    QMainWindow::paintEvent(event);
+    
+    if (m_firstFramePainted) {
+        return;
+    }
+    m_firstFramePainted = true;
+    StartupTimeline::instance().mark(StartupTimeline::FirstFrame);
+    
+    // Queue behind the backing-store flush of this frame.
+    if (m_telemetryConfig) {
+        QTimer::singleShot(0, this, &MainWindow::startTelemetrySources);
+    }
+}
+
+void MainWindow::startTelemetrySources()
+{
+    if (!m_telemetryConfig) {
+        return;
+    }
+    const CalibrationManager &config = *m_telemetryConfig;
+    
+    if (m_replaySource) {
+        startReplay();
+        delete m_telemetryConfig;
+        m_telemetryConfig = nullptr;
+        StartupTimeline::instance().mark(StartupTimeline::TelemetryStarted);
+        return;
+    }
+    
+    // Recorder first so the very first samples are captured.
+    setupRecorder(config);
+    
+    // In-process INA219 sampling replaces the bridge when the chip answers.
+    setupBatterySampler(config);
+    
+    // Binary bridge telemetry; fall back to stdout JSON if the socket can't bind.
+    if (!m_batterySampler && config.telemetryTransport() == "uds") {
+        m_telemetrySocket = new TelemetrySocket(config.telemetrySocketPath(), this);
+        if (!m_telemetrySocket->isOpen()) {
+            delete m_telemetrySocket;
+            m_telemetrySocket = nullptr;
+        }
+    }
+    
+    setupPythonBridge();
+    m_serialReader->start();
+    
+    delete m_telemetryConfig;
+    m_telemetryConfig = nullptr;
+    StartupTimeline::instance().mark(StartupTimeline::TelemetryStarted);
+    qDebug() << "Telemetry sources started";
+}
+
+void MainWindow::startReplay()
+{
+    // Same slots as the live sources; nothing on the car is opened.
+    if (!m_replaySource->load()) {
+        qWarning() << "Replay: no usable events, dashboard stays idle";
+        return;
+    }
+    connect(m_replaySource, &ReplaySource::canFrameReplayed,
+            m_serialReader, &SerialReader::injectFrame);
+    connect(m_replaySource, &ReplaySource::telemetryReplayed,
+            this, &MainWindow::onTelemetryReceived);
+    if (m_replaySource->options().exitWhenDone) {
+        connect(m_replaySource, &ReplaySource::finished,
+                qApp, &QCoreApplication::quit, Qt::QueuedConnection);
+    }
+    
+    m_serialReader->startReplay();
+    m_replaySource->start();
+    qDebug() << "Replay started:" << m_replaySource->eventCount() << "events";
+}
+
+void MainWindow::setupRecorder(const CalibrationManager &config)
+{
+    if (!config.recorderEnabled()) {
+        return;
+    }
+    
+    m_recorder = new TelemetryRecorder();
+    if (!m_recorder->open(config.recorderPath(), config.recorderRetentionSec(),
+                          config.recorderMaxRateHz())) {
+        qWarning() << "Telemetry recording disabled";
+        delete m_recorder;
+        m_recorder = nullptr;
+        return;
+    }
+    m_serialReader->setRecorder(m_recorder);
+}
+
+void MainWindow::recordBattery(float voltage, float currentMa, float percent,
+                               qint64 timestampNs, quint32 aux)
+{
+    if (!m_recorder) {
+        return;
+    }
+    m_recorder->record(TelemetryRecord::KIND_BATTERY_VOLTAGE, TelemetryRecord::SOURCE_BRIDGE,
+                       voltage, timestampNs, aux);
+    m_recorder->record(TelemetryRecord::KIND_BATTERY_CURRENT_MA, TelemetryRecord::SOURCE_BRIDGE,
+                       currentMa, timestampNs, aux);
+    m_recorder->record(TelemetryRecord::KIND_BATTERY_PERCENT, TelemetryRecord::SOURCE_BRIDGE,
+                       percent, timestampNs, aux);
+}
+
+void MainWindow::setupBatterySampler(const CalibrationManager &config)
+{
+    const QString source = config.batterySource();
+    Ina219Device *device = nullptr;
+    if (source == "i2c") {
+        device = new I2cIna219Device(config.batteryI2cBus(), config.batteryI2cAddress());
+    } else if (source == "mock") {
+        device = new MockIna219Device();
+    } else {
+        return;  // "bridge"
+    }
+    
+    m_batterySampler = new Ina219Sampler(device, config.batterySampleRateHz(), this);
+    m_batterySampler->setRecorder(m_recorder);
+    if (!m_batterySampler->startSampling()) {
+        qWarning() << "INA219 unavailable, falling back to Python bridge for battery data";
+        delete m_batterySampler;
+        m_batterySampler = nullptr;
+        return;
+    }
+    m_socEstimator = new SocEstimator(config.batteryCapacityMah(), config.batterySocAlpha());
+}
+
+void MainWindow::drainBatterySampler()
+{
+    // Every reading feeds the SOC filter; only the result is displayed.
+    BatterySample sample;
+    bool haveSample = false;
+    while (m_batterySampler->popSample(sample)) {
+        m_socEstimator->update(sample.reading.voltage, sample.reading.currentMa,
+                               sample.timestampNs);
+        haveSample = true;
+    }
+    if (!haveSample) {
+        return;
+    }
+    
+    StartupTimeline::instance().mark(StartupTimeline::FirstBatterySample);
+    m_pendingBatteryVoltage = m_socEstimator->stableVoltage();
+    m_pendingBatteryPercent = m_socEstimator->socPercent();
+    m_batteryPending = true;
+    if (m_recorder) {
+        m_recorder->record(TelemetryRecord::KIND_BATTERY_PERCENT, TelemetryRecord::SOURCE_DASHBOARD,
+                           m_pendingBatteryPercent, TelemetryRecorder::nowNs());
+    }
+}
+
 void MainWindow::setupPythonBridge()
 {
+    // Battery is sampled in-process; the bridge has nothing left to deliver.
+    if (m_batterySampler) {
+        return;
+    }
+    
     m_pythonProcess = new QProcess(this);
     
     // Connect signals
     connect(m_pythonProcess, &QProcess::readyReadStandardOutput,
             this, &MainWindow::onPythonDataReceived);
+    if (m_telemetrySocket) {
+        connect(m_telemetrySocket, &TelemetrySocket::telemetryReceived,
+                this, &MainWindow::onTelemetryReceived);
+    }
     
     connect(m_pythonProcess, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
             [this](int exitCode, QProcess::ExitStatus exitStatus) {
                 qWarning() << "Python bridge exited with code:" << exitCode;
             });
     
+    // Start result arrives asynchronously; the GUI thread never waits on fork/exec.
+    connect(m_pythonProcess, &QProcess::started, this, []() {
+        qDebug() << "Python bridge started successfully";
+    });
+    connect(m_pythonProcess, &QProcess::errorOccurred,
+            this, [](QProcess::ProcessError error) {
+                if (error == QProcess::FailedToStart) {
+                    qWarning() << "Failed to start Python bridge!";
+                    qWarning() << "Running without battery data...";
+                }
+            });
+    
     // Start Python bridge
     const QString appDir = QCoreApplication::applicationDirPath();
     const QStringList candidateScripts = {
@@ -384,23 +758,39 @@ void MainWindow::setupPythonBridge()
         return;
     }
 
-    m_pythonProcess->start("python3", QStringList() << pythonScript);
-    
-    if (!m_pythonProcess->waitForStarted(3000)) {
-        qWarning() << "Failed to start Python bridge!";
-        qWarning() << "Running without battery data...";
-    } else {
-        qDebug() << "Python bridge started successfully";
+    QStringList arguments;
+    arguments << pythonScript;
+    if (m_telemetrySocket) {
+        arguments << "--transport" << "uds" << "--socket" << m_telemetrySocket->path();
     }
+    m_pythonProcess->start("python3", arguments);
 }
 
 void MainWindow::applyStyles()
 {
     // Base style is provided by dynamic theme builder.
-    applyDynamicBackgroundTheme("P");
+    applyDynamicBackgroundTheme(m_appliedTheme.isEmpty() ? QStringLiteral("P") : m_appliedTheme);
 }
 
 void MainWindow::applyDynamicBackgroundTheme(const QString &mode)
+{
+    const QString key = (mode == "F" || mode == "R") ? mode : QStringLiteral("P");
+    // A window-wide setStyleSheet re-polishes every child; only do it on a real change.
+    if (key == m_appliedTheme) {
+        return;
+    }
+    if (m_themeStyles.isEmpty()) {
+        for (const QString &theme : {QStringLiteral("F"), QStringLiteral("R"), QStringLiteral("P")}) {
+            m_themeStyles.insert(theme, buildThemeStyle(theme));
+        }
+    }
+
+    setStyleSheet(m_themeStyles.value(key));
+    m_appliedTheme = key;
+    ++m_restyleCount;
+}
+
+QString MainWindow::buildThemeStyle(const QString &mode)
 {
     QString tintCore = "#10223D";
     QString tintMid = "#0A1730";
@@ -460,7 +850,15 @@ void MainWindow::applyDynamicBackgroundTheme(const QString &mode)
         "   background: transparent;"
         "   color: #E8F0FF;"
         "}";
-    setStyleSheet(fullStyle);
+    return fullStyle;
+}
+
+void MainWindow::repolish(QWidget *widget)
+{
+    widget->style()->unpolish(widget);
+    widget->style()->polish(widget);
+    widget->update();
+    ++m_restyleCount;
 }
 
 void MainWindow::animateCenterMode(const QString &newMode)
@@ -522,123 +920,154 @@ void MainWindow::animateCenterMode(const QString &newMode)
     m_centerModeAnim->start();
 }
 
-bool MainWindow::updateDirectionFromSnapshot()
+void MainWindow::onDriveModeChanged(const QString &direction)
 {
-    QFileInfo directionInfo("/tmp/piracer_drive_mode.json");
-    if (!directionInfo.exists()) {
-        return false;
+    m_driveDirection = direction;
+    if (m_recorder) {
+        const float value = (direction == "F") ? 1.0f : (direction == "R") ? -1.0f : 0.0f;
+        m_recorder->record(TelemetryRecord::KIND_DIRECTION, TelemetryRecord::SOURCE_DRIVE_MODE,
+                           value, TelemetryRecorder::nowNs());
     }
+    updateDirectionIndicators();
+}
 
-    // Use snapshot only when it is fresh enough.
-    if (directionInfo.lastModified().msecsTo(QDateTime::currentDateTime()) > 2000) {
-        return false;
-    }
+void MainWindow::onDriveModeFreshnessChanged(bool fresh)
+{
+    // The last direction stays displayed; the indicator only marks it as outdated.
+    m_parkingLabel->setProperty("stale", !fresh);
+    repolish(m_parkingLabel);
+}
 
-    QFile directionFile(directionInfo.absoluteFilePath());
-    if (!directionFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        return false;
-    }
+void MainWindow::onSpeedDataReceived(float pulsePerSec, qint64 rxTimestampNs, quint32 traceId)
+{
+    Q_UNUSED(rxTimestampNs);  // Carried by the trace
 
-    const QByteArray payload = directionFile.readAll();
-    directionFile.close();
-    const QJsonDocument doc = QJsonDocument::fromJson(payload);
-    if (!doc.isObject()) {
-        return false;
-    }
+    // SerialReader now emits CAN speed directly in km/h.
+    // Only the newest sample per frame reaches the widgets.
+    StartupTimeline::instance().mark(StartupTimeline::FirstCanSample);
+    m_currentSpeed = pulsePerSec;
+    m_pendingSpeed = pulsePerSec;
+    m_pendingSpeedTrace = traceId;
+    m_speedPending = true;
+}
 
-    const QString direction = doc.object().value("direction").toString().trimmed().toUpper();
-    if (direction.startsWith("R")) {
-        m_driveDirection = "R";
-        return true;
-    }
-    if (direction.startsWith("F")) {
-        m_driveDirection = "F";
-        return true;
-    }
-    if (direction.startsWith("N")) {
-        m_driveDirection = "N";
-        return true;
-    }
+void MainWindow::onRpmDataReceived(float rpm)
+{
+    StartupTimeline::instance().mark(StartupTimeline::FirstCanSample);
+    m_lastCanRpmTime = QDateTime::currentMSecsSinceEpoch();
+    m_pendingRpm = rpm;
+    m_rpmPending = true;
+}
 
-    return false;
+void MainWindow::onFrame(float dtSeconds)
+{
+    // Thread mode: pull queued CAN samples first so they land in this frame.
+    m_serialReader->drainIngestRing();
+    if (m_batterySampler) {
+        drainBatterySampler();
+    }
+    applyPendingTelemetry();
+    
+    // Widgets only schedule a repaint when something moved; Qt merges
+    // them into a single paint pass for the window.
+    m_speedometer->advance(dtSeconds);
+    m_rpmGauge->advance(dtSeconds);
 }
 
-void MainWindow::onSpeedDataReceived(float pulsePerSec)
+void MainWindow::applyPendingTelemetry()
 {
-    // SerialReader now emits CAN speed directly in km/h.
-    const float speedKmh = pulsePerSec;
-    float rpm = 0.0f;
-    if (m_dataProcessor->speedCalibration() > 0.0f) {
-        const float estimatedPulsePerSec = speedKmh / m_dataProcessor->speedCalibration();
-        rpm = m_dataProcessor->pulseToRPM(estimatedPulsePerSec);
+    if (m_batteryPending) {
+        m_batteryPending = false;
+        m_batteryWidget->setBattery(m_pendingBatteryPercent, m_pendingBatteryVoltage);
+    }
+    
+    if (m_rpmPending) {
+        m_rpmPending = false;
+        m_rpmGauge->setRPM(m_pendingRpm);
+    }
+    
+    if (!m_speedPending) {
+        return;
     }
-    m_currentSpeed = speedKmh;
-    updateDirectionFromSnapshot();
+    m_speedPending = false;
+    const float speedKmh = m_pendingSpeed;
     
     // Update widgets
-    m_speedometer->setSpeed(speedKmh);
-    m_rpmGauge->setRPM(rpm);
-    updateDirectionIndicators();
+    LatencyTracer::instance().markUpdated(m_pendingSpeedTrace);
+    m_speedometer->setSpeed(speedKmh, m_pendingSpeedTrace);
+    // Estimate RPM from speed unless the bus is providing it directly.
+    const bool canRpmFresh = m_lastCanRpmTime > 0 &&
+        QDateTime::currentMSecsSinceEpoch() - m_lastCanRpmTime < CAN_RPM_TIMEOUT_MS;
+    if (!canRpmFresh && m_dataProcessor->speedCalibration() > 0.0f) {
+        const float estimatedPulsePerSec = speedKmh / m_dataProcessor->speedCalibration();
+        m_rpmGauge->setRPM(m_dataProcessor->pulseToRPM(estimatedPulsePerSec));
+    } else if (!canRpmFresh) {
+        m_rpmGauge->setRPM(0.0f);
+    }
     
     // Update max speed
     if (speedKmh > m_maxSpeed) {
         m_maxSpeed = speedKmh;
         m_maxSpeedLabel->setText(QString("%1").arg(m_maxSpeed, 0, 'f', 1));
         // Pulse effect when a new max speed record is set.
-        m_maxSpeedLabel->setStyleSheet(
-            "QLabel {"
-            "   color: #A7F6FF;"
-            "   font-family: 'Roboto Mono';"
-            "   font-size: 21pt;"
-            "   font-weight: bold;"
-            "}"
-        );
-        QTimer::singleShot(180, this, [this]() {
-            if (!m_maxSpeedLabel) return;
-            m_maxSpeedLabel->setStyleSheet(
-                "QLabel {"
-                "   color: #00D4FF;"
-                "   font-family: 'Roboto Mono';"
-                "   font-size: 20pt;"
-                "   font-weight: bold;"
-                "}"
-            );
-        });
+        if (!m_maxSpeedLabel->property("pulse").toBool()) {
+            m_maxSpeedLabel->setProperty("pulse", true);
+            repolish(m_maxSpeedLabel);
+        }
+        m_maxSpeedPulseTimer->start(180);
     }
 }
 
 void MainWindow::onPythonDataReceived()
 {
-    m_pythonStdoutBuffer += QString::fromUtf8(m_pythonProcess->readAllStandardOutput());
+    // Legacy JSON transport (telemetry.transport = "json").
+    m_pythonStdoutBuffer += m_pythonProcess->readAllStandardOutput();
 
-    while (m_pythonStdoutBuffer.contains('\n')) {
-        const int newlinePos = m_pythonStdoutBuffer.indexOf('\n');
-        const QString jsonLine = m_pythonStdoutBuffer.left(newlinePos).trimmed();
-        m_pythonStdoutBuffer = m_pythonStdoutBuffer.mid(newlinePos + 1);
+    // Scan complete lines in place and drop them from the buffer once.
+    int lineStart = 0;
+    int newlinePos;
+    while ((newlinePos = m_pythonStdoutBuffer.indexOf('\n', lineStart)) >= 0) {
+        const QByteArray jsonLine =
+            m_pythonStdoutBuffer.mid(lineStart, newlinePos - lineStart).trimmed();
+        lineStart = newlinePos + 1;
 
         if (jsonLine.isEmpty()) {
             continue;
         }
 
         // Parse one JSON object per line
-        QJsonDocument doc = QJsonDocument::fromJson(jsonLine.toUtf8());
+        QJsonDocument doc = QJsonDocument::fromJson(jsonLine);
         if (!doc.isObject()) {
             continue;
         }
 
         QJsonObject obj = doc.object();
         QJsonObject battery = obj["battery"].toObject();
-        // Update battery widget
-        float voltage = battery["voltage"].toDouble();
-        float percent = battery["percent"].toDouble();
-        m_batteryWidget->setBattery(percent, voltage);
-
-        // Direction is controlled by the local drive-mode snapshot (X/B/Y).
-        // Ignore bridge direction to avoid parking flicker during driving.
-        if (updateDirectionFromSnapshot()) {
-            updateDirectionIndicators();
-        }
+        StartupTimeline::instance().mark(StartupTimeline::FirstBatterySample);
+        // Battery widget is updated on the next frame
+        m_pendingBatteryVoltage = battery["voltage"].toDouble();
+        m_pendingBatteryPercent = battery["percent"].toDouble();
+        m_batteryPending = true;
+        recordBattery(m_pendingBatteryVoltage, battery["current"].toDouble(),
+                      m_pendingBatteryPercent, TelemetryRecorder::nowNs(), 0);
+
+        // Direction is controlled by the local drive-mode snapshot (X/B/Y)
+        // via DriveModeSource. Ignore bridge direction to avoid parking
+        // flicker during driving.
     }
+    m_pythonStdoutBuffer.remove(0, lineStart);
+}
+
+void MainWindow::onTelemetryReceived(const TelemetryPacket &packet)
+{
+    // Battery widget is updated on the next frame; direction stays with
+    // DriveModeSource, as on the JSON path.
+    StartupTimeline::instance().mark(StartupTimeline::FirstBatterySample);
+    m_pendingBatteryVoltage = packet.voltage;
+    m_pendingBatteryPercent = packet.percent;
+    m_batteryPending = true;
+    recordBattery(packet.voltage, packet.currentMa, packet.percent,
+                  packet.timestampNs, packet.sequence);
 }
 
 void MainWindow::onResetButtonClicked()
@@ -666,6 +1095,13 @@ void MainWindow::updateElapsedTime()
                          .arg(hours, 2, 10, QChar('0'))
                          .arg(minutes, 2, 10, QChar('0'))
                          .arg(seconds, 2, 10, QChar('0')));
+
+    // Restyle rate: should stay at zero while driving in one mode.
+    m_restylesPerSecond = static_cast<int>(m_restyleCount - m_restyleCountAtLastTick);
+    m_restyleCountAtLastTick = m_restyleCount;
+    if (m_restylesPerSecond > 0) {
+        qDebug() << "Restyles/s:" << m_restylesPerSecond << "total:" << m_restyleCount;
+    }
 }
 
 void MainWindow::applyDirectionIndicatorStyle(QLabel *label, bool active, const QString &activeColor)
@@ -715,17 +1151,20 @@ void MainWindow::updateDirectionIndicators()
         current = "R";
     }
 
+    // Labels only need touching when the displayed mode actually changes.
+    if (current == m_indicatorMode) {
+        return;
+    }
+    m_indicatorMode = current;
+
     QString leftHint = "F";
     QString rightHint = "R";
-    QString activeColor = "#FFD34D";  // Parking default
     if (current == "F") {
         leftHint = "P";
         rightHint = "R";
-        activeColor = "#00FF88";
     } else if (current == "R") {
         leftHint = "F";
         rightHint = "P";
-        activeColor = "#FF5B6E";
     }
 
     m_forwardLabel->setText(leftHint);
@@ -733,40 +1172,6 @@ void MainWindow::updateDirectionIndicators()
     animateCenterMode(current);
     applyDynamicBackgroundTheme(current);
 
-    m_forwardLabel->setStyleSheet(
-        "QLabel {"
-        "   background-color: #1A2940;"
-        "   color: #8FA6C2;"
-        "   border: 1px solid #2D4867;"
-        "   border-radius: 8px;"
-        "   font-family: 'Roboto Condensed';"
-        "   font-size: 10pt;"
-        "   font-weight: 600;"
-        "   padding: 2px 2px;"
-        "}"
-    );
-    m_backwardLabel->setStyleSheet(
-        "QLabel {"
-        "   background-color: #1A2940;"
-        "   color: #8FA6C2;"
-        "   border: 1px solid #2D4867;"
-        "   border-radius: 8px;"
-        "   font-family: 'Roboto Condensed';"
-        "   font-size: 10pt;"
-        "   font-weight: 600;"
-        "   padding: 2px 2px;"
-        "}"
-    );
-    m_parkingLabel->setStyleSheet(
-        "QLabel {"
-        "   background-color: " + activeColor + ";"
-        "   color: #08121F;"
-        "   border: 1px solid " + activeColor + ";"
-        "   border-radius: 8px;"
-        "   font-family: 'Roboto Condensed';"
-        "   font-size: 18pt;"
-        "   font-weight: 800;"
-        "   padding: 0px 2px;"
-        "}"
-    );
+    m_parkingLabel->setProperty("mode", current);
+    repolish(m_parkingLabel);
 }
@@ -16,6 +16,8 @@
 #include <QTimer>
 #include <QProcess>
 #include <QString>
+#include <QByteArray>
+#include <QHash>
 
 // Forward declarations
 class SpeedometerWidget;
@@ -23,6 +25,18 @@ class RpmGauge;
 class BatteryWidget;
 class SerialReader;
 class DataProcessor;
+class DriveModeSource;
+class FrameScheduler;
+class CalibrationManager;
+class TelemetrySocket;
+class Ina219Sampler;
+class SocEstimator;
+class LatencyOverlay;
+class UnixSignalNotifier;
+class TelemetryRecorder;
+class ReplaySource;
+struct ReplayOptions;
+struct TelemetryPacket;
 class QGraphicsOpacityEffect;
 class QParallelAnimationGroup;
 
@@ -40,24 +54,44 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
-    explicit MainWindow(QWidget *parent = nullptr);
+    // A non-empty replay selection replaces can0, the INA219 and the bridge.
+    explicit MainWindow(const ReplayOptions &replay, QWidget *parent = nullptr);
     ~MainWindow();
 
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
 private slots:
-    void onSpeedDataReceived(float pulsePerSec);
+    void onSpeedDataReceived(float pulsePerSec, qint64 rxTimestampNs, quint32 traceId);
+    void onRpmDataReceived(float rpm);
+    void onDriveModeChanged(const QString &direction);
+    void onDriveModeFreshnessChanged(bool fresh);
+    void onFrame(float dtSeconds);
     void onPythonDataReceived();
+    void onTelemetryReceived(const TelemetryPacket &packet);
     void onResetButtonClicked();
     void updateElapsedTime();
+    void dumpLatency();
     
 private:
     void setupUI();
     void setupConnections();
     void setupPythonBridge();
+    void startTelemetrySources();
+    void startReplay();
+    void setupLatencyDiagnostics(const CalibrationManager &config);
     void applyStyles();
     void applyDynamicBackgroundTheme(const QString &mode);
+    static QString buildThemeStyle(const QString &mode);
+    void repolish(QWidget *widget);
     void animateCenterMode(const QString &newMode);
-    bool updateDirectionFromSnapshot();
     void updateDirectionIndicators();
+    void applyPendingTelemetry();
+    void setupBatterySampler(const CalibrationManager &config);
+    void setupRecorder(const CalibrationManager &config);
+    void recordBattery(float voltage, float currentMa, float percent,
+                       qint64 timestampNs, quint32 aux);
+    void drainBatterySampler();
     void applyDirectionIndicatorStyle(QLabel *label, bool active, const QString &activeColor);
     
     // Widgets
@@ -77,17 +111,52 @@ private:
     SerialReader *m_serialReader;
     QProcess *m_pythonProcess;
     DataProcessor *m_dataProcessor;
-    QString m_pythonStdoutBuffer;
+    DriveModeSource *m_driveModeSource;
+    FrameScheduler *m_frameScheduler;
+    TelemetrySocket *m_telemetrySocket;  // nullptr when the bridge uses stdout JSON
+    Ina219Sampler *m_batterySampler;     // nullptr when battery data comes from the bridge
+    SocEstimator *m_socEstimator;        // Fed with every INA219 sample
+    TelemetryRecorder *m_recorder;       // nullptr when recording is disabled
+    ReplaySource *m_replaySource;        // nullptr unless started with --replay
+    CalibrationManager *m_telemetryConfig;  // Held until startTelemetrySources() runs
+    bool m_firstFramePainted;
+    QByteArray m_pythonStdoutBuffer;
     
     // Statistics
     float m_maxSpeed;
     float m_currentSpeed;
+    qint64 m_lastCanRpmTime;  // Last RPM straight from CAN; 0 = derive RPM from speed
     QString m_driveDirection;
+    
+    // Latest samples since the last frame; applied once per frame
+    float m_pendingSpeed;
+    float m_pendingRpm;
+    float m_pendingBatteryPercent;
+    float m_pendingBatteryVoltage;
+    quint32 m_pendingSpeedTrace;  // LatencyTracer ID of m_pendingSpeed
+    bool m_speedPending;
+    bool m_rpmPending;
+    bool m_batteryPending;
+    
     QString m_lastCenterMode;
     QGraphicsOpacityEffect *m_centerModeOpacity;
     QParallelAnimationGroup *m_centerModeAnim;
     QTimer *m_elapsedTimer;
     qint64 m_startTime;
+
+    // Style dirty tracking
+    QHash<QString, QString> m_themeStyles;  // Precomputed F/R/P window stylesheets
+    QString m_appliedTheme;
+    QString m_indicatorMode;
+    QTimer *m_maxSpeedPulseTimer;
+    quint64 m_restyleCount;
+    quint64 m_restyleCountAtLastTick;
+    int m_restylesPerSecond;
+    
+    // Latency diagnostics
+    LatencyOverlay *m_latencyOverlay;
+    UnixSignalNotifier *m_dumpSignal;   // SIGUSR1 -> dumpLatency()
+    QString m_latencyDumpPath;
     
     // Constants
     static constexpr int WINDOW_WIDTH = 1200;
@@ -95,6 +164,7 @@ private:
     static constexpr int LEFT_PANEL_WIDTH = 260;
     static constexpr int CENTER_PANEL_WIDTH = 560;
     static constexpr int RIGHT_PANEL_WIDTH = 240;
+    static constexpr qint64 CAN_RPM_TIMEOUT_MS = 1000;
 };
 
 #endif // MAINWINDOW_H
@@ -7,11 +7,20 @@
  */
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QtGlobal>
+#include <QDebug>
 #include "MainWindow.h"
+#include "ReplaySource.h"
+#include "StartupTimeline.h"
+#include "UnixSignalNotifier.h"
+
+#include <csignal>
 
 int main(int argc, char *argv[])
 {
+    StartupTimeline::instance().begin();
+    
     // Qt 5 compatibility: these attributes are deprecated in Qt 6.
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
     QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
@@ -25,9 +34,52 @@ int main(int argc, char *argv[])
     app.setApplicationVersion("1.0.0");
     app.setOrganizationName("PiRacer");
     
+    // Replay of recorded traces instead of the car's sources
+    QCommandLineParser parser;
+    parser.setApplicationDescription("PiRacer instrument cluster");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    const QCommandLineOption replayOption("replay",
+        "Replay a candump -L log (.log) or bridge JSON lines (.jsonl) instead of "
+        "can0, the INA219 and the bridge. Repeat to merge files.", "file");
+    const QCommandLineOption speedOption("replay-speed",
+        "Replay rate: 1 = real time, N = N x, max = as fast as possible.", "factor", "1");
+    const QCommandLineOption loopOption("replay-loop", "Restart the replay at the end.");
+    const QCommandLineOption exitOption("replay-exit", "Quit when the replay has finished.");
+    parser.addOption(replayOption);
+    parser.addOption(speedOption);
+    parser.addOption(loopOption);
+    parser.addOption(exitOption);
+    parser.process(app);
+    
+    ReplayOptions replay;
+    replay.files = parser.values(replayOption);
+    replay.loop = parser.isSet(loopOption);
+    replay.exitWhenDone = parser.isSet(exitOption);
+    const QString speed = parser.value(speedOption);
+    if (speed == "max") {
+        replay.speed = 0.0;
+    } else {
+        bool ok = false;
+        replay.speed = speed.toDouble(&ok);
+        if (!ok || replay.speed <= 0.0) {
+            qWarning() << "Invalid --replay-speed" << speed << "- using real time";
+            replay.speed = 1.0;
+        }
+    }
+    
     // Create and show main window
-    MainWindow window;
+    MainWindow window(replay);
     window.show();
     
-    return app.exec();
+    // SIGINT/SIGTERM quit through the event loop so the exit statistics
+    // (ingest totals, frame intervals, latency) are still printed.
+    UnixSignalNotifier interruptSignal(SIGINT);
+    UnixSignalNotifier terminateSignal(SIGTERM);
+    QObject::connect(&interruptSignal, &UnixSignalNotifier::activated, &app, &QCoreApplication::quit);
+    QObject::connect(&terminateSignal, &UnixSignalNotifier::activated, &app, &QCoreApplication::quit);
+    
+    const int exitCode = app.exec();
+    StartupTimeline::instance().print();
+    return exitCode;
 }
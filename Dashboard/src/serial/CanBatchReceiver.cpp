@@ -0,0 +1,98 @@
+/**
+ * @file CanBatchReceiver.cpp
+ * @brief Batched CAN Receiver Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "CanBatchReceiver.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+CanBatchReceiver::CanBatchReceiver(int batchSize)
+    : m_batchSize(qBound(1, batchSize, MAX_BATCH_SIZE))
+    , m_frames(m_batchSize)
+    , m_iov(m_batchSize)
+    , m_msgs(m_batchSize)
+    , m_control(m_batchSize * CONTROL_SIZE)
+    , m_timestampsNs(m_batchSize, 0)
+    , m_socketDrops(0)
+    , m_shortReads(0)
+{
+    for (int i = 0; i < m_batchSize; ++i) {
+        m_iov[i].iov_base = &m_frames[i];
+        m_iov[i].iov_len = sizeof(struct can_frame);
+    }
+}
+
+bool CanBatchReceiver::enableTimestamps(int canSocket)
+{
+    const int enable = 1;
+    return ::setsockopt(canSocket, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) == 0;
+}
+
+bool CanBatchReceiver::enableDropCounter(int canSocket)
+{
+    const int enable = 1;
+    return ::setsockopt(canSocket, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) == 0;
+}
+
+qint64 CanBatchReceiver::realtimeNowNs()
+{
+    struct timespec now;
+    ::clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+int CanBatchReceiver::receive(int canSocket)
+{
+    // recvmmsg() rewrites msg_controllen and msg_flags, so reset headers per call.
+    for (int i = 0; i < m_batchSize; ++i) {
+        struct msghdr &hdr = m_msgs[i].msg_hdr;
+        std::memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_iov = &m_iov[i];
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = m_control.data() + i * CONTROL_SIZE;
+        hdr.msg_controllen = CONTROL_SIZE;
+        m_msgs[i].msg_len = 0;
+    }
+
+    const int received = ::recvmmsg(canSocket, m_msgs.data(), m_batchSize, MSG_DONTWAIT, nullptr);
+    if (received < 0) {
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+    }
+
+    const qint64 fallbackNs = realtimeNowNs();
+    int valid = 0;
+    for (int i = 0; i < received; ++i) {
+        // Drop short reads; compact the remaining frames to the front.
+        if (m_msgs[i].msg_len < sizeof(struct can_frame)) {
+            ++m_shortReads;
+            continue;
+        }
+
+        qint64 stampNs = fallbackNs;
+        struct msghdr &hdr = m_msgs[i].msg_hdr;
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPNS) {
+                struct timespec ts;
+                std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                stampNs = static_cast<qint64>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+            } else if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+                // Cumulative drop count of the socket at the time of this frame
+                quint32 drops = 0;
+                std::memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+                m_socketDrops = drops;
+            }
+        }
+
+        if (valid != i) {
+            m_frames[valid] = m_frames[i];
+        }
+        m_timestampsNs[valid] = stampNs;
+        ++valid;
+    }
+    return valid;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file CanBusDiagnostics.cpp
+ * @brief CAN Bus Diagnostics Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "CanBusDiagnostics.h"
+
+#include <linux/can.h>
+#include <linux/can/error.h>
+
+CanBusCounters::CanBusCounters()
+    : m_errorFrames(0)
+    , m_state(static_cast<int>(CanBusState::Unknown))
+    , m_lastSampleNs(0)
+{
+    for (std::atomic<quint64> &count : m_classes) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+void CanBusCounters::recordErrorFrame(const struct can_frame &frame)
+{
+    static const struct {
+        canid_t bit;
+        ErrorClass errorClass;
+    } CLASS_BITS[] = {
+        {CAN_ERR_TX_TIMEOUT, TxTimeout},
+        {CAN_ERR_LOSTARB, LostArbitration},
+        {CAN_ERR_CRTL, Controller},
+        {CAN_ERR_PROT, Protocol},
+        {CAN_ERR_TRX, Transceiver},
+        {CAN_ERR_ACK, NoAck},
+        {CAN_ERR_BUSOFF, BusOff},
+        {CAN_ERR_BUSERROR, BusError},
+        {CAN_ERR_RESTARTED, Restarted},
+    };
+
+    m_errorFrames.fetch_add(1, std::memory_order_relaxed);
+    for (const auto &entry : CLASS_BITS) {
+        if (frame.can_id & entry.bit) {
+            m_classes[entry.errorClass].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // State transitions carried by the frame (data[1] holds the controller status)
+    if (frame.can_id & CAN_ERR_BUSOFF) {
+        setState(CanBusState::BusOff);
+    } else if (frame.can_id & CAN_ERR_RESTARTED) {
+        setState(CanBusState::ErrorActive);
+    } else if (frame.can_id & CAN_ERR_CRTL) {
+        const quint8 status = frame.data[1];
+        if (status & (CAN_ERR_CRTL_RX_PASSIVE | CAN_ERR_CRTL_TX_PASSIVE)) {
+            setState(CanBusState::ErrorPassive);
+        } else if (status & (CAN_ERR_CRTL_RX_WARNING | CAN_ERR_CRTL_TX_WARNING)) {
+            setState(CanBusState::ErrorWarning);
+        } else if (status & CAN_ERR_CRTL_ACTIVE) {
+            setState(CanBusState::ErrorActive);
+        }
+    }
+}
+
+const char *CanBusCounters::errorClassName(ErrorClass errorClass)
+{
+    switch (errorClass) {
+    case TxTimeout: return "tx-timeout";
+    case LostArbitration: return "lost-arbitration";
+    case Controller: return "controller";
+    case Protocol: return "protocol";
+    case Transceiver: return "transceiver";
+    case NoAck: return "no-ack";
+    case BusOff: return "bus-off";
+    case BusError: return "bus-error";
+    case Restarted: return "restarted";
+    case ERROR_CLASS_COUNT: break;
+    }
+    return "?";
+}
+
+const char *CanBusCounters::stateName(CanBusState state)
+{
+    switch (state) {
+    case CanBusState::ErrorActive: return "error-active";
+    case CanBusState::ErrorWarning: return "error-warning";
+    case CanBusState::ErrorPassive: return "error-passive";
+    case CanBusState::BusOff: return "bus-off";
+    case CanBusState::Stopped: return "stopped";
+    case CanBusState::Sleeping: return "sleeping";
+    case CanBusState::Unknown: break;
+    }
+    return "unknown";
+}
+
+QString CanBusDiagnostics::summary() const
+{
+    const QString age = lastSampleAgeMs < 0 ? QStringLiteral("none")
+                                            : QString::number(lastSampleAgeMs) + " ms";
+    return QStringLiteral("bus %1 %2 %3, last sample %4\n"
+                          "drops %5 sock %6 ring, err %7 (bus-off %8), link down %9")
+        .arg(interfaceName)
+        .arg(linkUp ? (connected ? "up" : "up/closed") : "down")
+        .arg(CanBusCounters::stateName(busState))
+        .arg(age)
+        .arg(socketDrops)
+        .arg(ringOverflows)
+        .arg(errorFrames)
+        .arg(errorClasses[CanBusCounters::BusOff])
+        .arg(linkDownEvents);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file CanBusDiagnostics.h
+ * @brief CAN Bus Health Counters (error frames, bus state, sample age)
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef CANBUSDIAGNOSTICS_H
+#define CANBUSDIAGNOSTICS_H
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+struct can_frame;
+
+/**
+ * @enum CanBusState
+ * @brief Controller state, same order as the kernel's enum can_state
+ */
+enum class CanBusState {
+    ErrorActive = 0,
+    ErrorWarning,
+    ErrorPassive,
+    BusOff,
+    Stopped,
+    Sleeping,
+    Unknown
+};
+
+/**
+ * @class CanBusCounters
+ * @brief Lock-free bus health counters shared by the GUI and ingest threads
+ *
+ * Features:
+ * - Error frames (CAN_RAW_ERR_FILTER) counted per class of can_id bits
+ * - Controller state from error frames and from netlink IFLA_CAN_STATE
+ * - Receive time of the newest decoded sample
+ *
+ * One writer at a time (whichever thread reads the socket); any thread
+ * may read.
+ */
+class CanBusCounters
+{
+public:
+    enum ErrorClass {
+        TxTimeout,
+        LostArbitration,
+        Controller,
+        Protocol,
+        Transceiver,
+        NoAck,
+        BusOff,
+        BusError,
+        Restarted,
+        ERROR_CLASS_COUNT
+    };
+
+    CanBusCounters();
+
+    // frame.can_id must have CAN_ERR_FLAG set
+    void recordErrorFrame(const struct can_frame &frame);
+    void recordSample(qint64 rxTimestampNs) { m_lastSampleNs.store(rxTimestampNs, std::memory_order_relaxed); }
+    void setState(CanBusState state) { m_state.store(static_cast<int>(state), std::memory_order_relaxed); }
+
+    quint64 errorFrames() const { return m_errorFrames.load(std::memory_order_relaxed); }
+    quint64 errorClass(ErrorClass errorClass) const { return m_classes[errorClass].load(std::memory_order_relaxed); }
+    CanBusState state() const { return static_cast<CanBusState>(m_state.load(std::memory_order_relaxed)); }
+    qint64 lastSampleNs() const { return m_lastSampleNs.load(std::memory_order_relaxed); }
+
+    static const char *errorClassName(ErrorClass errorClass);
+    static const char *stateName(CanBusState state);
+
+private:
+    std::atomic<quint64> m_errorFrames;
+    std::atomic<quint64> m_classes[ERROR_CLASS_COUNT];
+    std::atomic<int> m_state;
+    std::atomic<qint64> m_lastSampleNs;  // 0 = no sample yet
+};
+
+/**
+ * @struct CanBusDiagnostics
+ * @brief Snapshot returned by SerialReader::diagnostics()
+ */
+struct CanBusDiagnostics
+{
+    QString interfaceName;
+    bool linkUp = false;            // IFF_UP and IFF_RUNNING (carrier)
+    bool connected = false;         // Socket bound and being read
+    CanBusState busState = CanBusState::Unknown;
+    quint64 framesRead = 0;
+    quint64 socketDrops = 0;        // SO_RXQ_OVFL
+    quint64 ringOverflows = 0;      // Ingest thread ring full
+    quint64 shortReads = 0;         // recvmmsg() entries shorter than a can_frame
+    quint64 receiveErrors = 0;      // Socket errors that closed the connection
+    quint64 errorFrames = 0;
+    quint64 errorClasses[CanBusCounters::ERROR_CLASS_COUNT] = {};
+    quint64 linkDownEvents = 0;
+    quint64 reconnects = 0;
+    qint64 lastSampleAgeMs = -1;    // -1 = no sample yet
+
+    // Two short lines for the debug overlay and logs
+    QString summary() const;
+};
+
+#endif // CANBUSDIAGNOSTICS_H
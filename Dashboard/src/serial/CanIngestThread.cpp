@@ -0,0 +1,129 @@
+/**
+ * @file CanIngestThread.cpp
+ * @brief CAN Ingest Thread Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "CanIngestThread.h"
+#include "CanBatchReceiver.h"
+#include "CanBusDiagnostics.h"
+#include "CanSignalDecoder.h"
+#include "TelemetryRecorder.h"
+#include <QDebug>
+
+#include <cerrno>
+#include <poll.h>
+
+CanIngestThread::CanIngestThread(int canSocket, const CanSignalDecoder *decoder, int batchSize,
+                                 QObject *parent)
+    : QThread(parent)
+    , m_canSocket(canSocket)
+    , m_decoder(decoder)
+    , m_batchSize(batchSize)
+    , m_stopRequested(false)
+    , m_recorder(nullptr)
+    , m_speedSignal(-1)
+    , m_rpmSignal(-1)
+    , m_busCounters(nullptr)
+    , m_framesRead(0)
+    , m_samplesQueued(0)
+    , m_ringOverflows(0)
+    , m_socketDrops(0)
+    , m_shortReads(0)
+    , m_socketFailed(false)
+{
+}
+
+CanIngestThread::~CanIngestThread()
+{
+    stopAndWait();
+}
+
+void CanIngestThread::stopAndWait()
+{
+    m_stopRequested.store(true, std::memory_order_relaxed);
+    wait();
+}
+
+void CanIngestThread::setRecorder(TelemetryRecorder *recorder, int speedSignal, int rpmSignal)
+{
+    m_recorder = recorder;
+    m_speedSignal = speedSignal;
+    m_rpmSignal = rpmSignal;
+}
+
+void CanIngestThread::run()
+{
+    CanBatchReceiver receiver(m_batchSize);
+    CanSignalDecoder::Value values[CanSignalDecoder::MAX_VALUES_PER_FRAME];
+
+    struct pollfd pfd;
+    pfd.fd = m_canSocket;
+    pfd.events = POLLIN;
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        pfd.revents = 0;
+        const int ready = ::poll(&pfd, 1, POLL_TIMEOUT_MS);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            qWarning() << "CAN ingest poll failed, errno" << errno;
+            m_socketFailed.store(true, std::memory_order_release);
+            break;
+        }
+        if (ready == 0) {
+            continue;
+        }
+        if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            qWarning() << "CAN ingest socket closed";
+            m_socketFailed.store(true, std::memory_order_release);
+            break;
+        }
+
+        const int count = receiver.receive(m_canSocket);
+        if (count < 0) {
+            qWarning() << "CAN ingest receive failed, errno" << errno;
+            m_socketFailed.store(true, std::memory_order_release);
+            break;
+        }
+        m_framesRead.fetch_add(static_cast<quint64>(count), std::memory_order_relaxed);
+        m_socketDrops.store(receiver.socketDrops(), std::memory_order_relaxed);
+        m_shortReads.store(receiver.shortReads(), std::memory_order_relaxed);
+
+        for (int i = 0; i < count; ++i) {
+            const struct can_frame &frame = receiver.frame(i);
+            if (frame.can_id & CAN_ERR_FLAG) {
+                if (m_busCounters) {
+                    m_busCounters->recordErrorFrame(frame);
+                }
+                continue;
+            }
+            const int decoded = m_decoder->decode(frame.can_id, frame.data, frame.can_dlc,
+                                                  values, CanSignalDecoder::MAX_VALUES_PER_FRAME);
+            for (int v = 0; v < decoded; ++v) {
+                CanSignalSample sample;
+                sample.rxTimestampNs = receiver.timestampNs(i);
+                sample.signal = values[v].signal;
+                sample.value = values[v].value;
+                if (m_recorder) {
+                    const TelemetryRecord::Kind kind =
+                        (sample.signal == m_speedSignal) ? TelemetryRecord::KIND_SPEED_KMH
+                        : (sample.signal == m_rpmSignal) ? TelemetryRecord::KIND_WHEEL_RPM
+                                                         : TelemetryRecord::KIND_CAN_SIGNAL;
+                    m_recorder->record(kind, TelemetryRecord::SOURCE_CAN, sample.value,
+                                       sample.rxTimestampNs, frame.can_id);
+                }
+                if (m_busCounters) {
+                    m_busCounters->recordSample(sample.rxTimestampNs);
+                }
+                if (m_ring.push(sample)) {
+                    m_samplesQueued.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    m_ringOverflows.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+}
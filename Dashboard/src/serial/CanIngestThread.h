@@ -0,0 +1,103 @@
+/**
+ * @file CanIngestThread.h
+ * @brief Dedicated SocketCAN Reader Thread
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef CANINGESTTHREAD_H
+#define CANINGESTTHREAD_H
+
+#include <QThread>
+#include <atomic>
+
+#include "SpscRing.h"
+
+class CanBusCounters;
+class CanSignalDecoder;
+class TelemetryRecorder;
+
+/**
+ * @struct CanSignalSample
+ * @brief Decoded signal value handed from the ingest thread to the GUI thread
+ */
+struct CanSignalSample
+{
+    qint64 rxTimestampNs;   // Kernel receive time (CLOCK_REALTIME)
+    int signal;             // CanSignalDecoder signal index
+    float value;
+};
+
+/**
+ * @class CanIngestThread
+ * @brief Drains an already bound CAN socket off the GUI thread
+ *
+ * Features:
+ * - Blocks in poll() on the socket, independent of GUI repaint cost
+ * - Drains each wakeup in recvmmsg() batches with kernel timestamps
+ * - Decodes frames with the shared CanSignalDecoder tables
+ * - Pushes decoded samples into a lock-free SPSC ring
+ * - Counts frames and ring overflows for throughput measurement
+ * - Optionally logs every decoded value to a TelemetryRecorder
+ * - Error frames and sample times go to the shared CanBusCounters
+ *
+ * The socket and decoder are owned by the caller; the socket must stay
+ * open and the decoder unchanged until stopAndWait() has returned.
+ */
+class CanIngestThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    static constexpr std::size_t RING_SIZE = 1024;
+    using SampleRing = SpscRing<CanSignalSample, RING_SIZE>;
+
+    CanIngestThread(int canSocket, const CanSignalDecoder *decoder, int batchSize,
+                    QObject *parent = nullptr);
+    ~CanIngestThread() override;
+
+    void stopAndWait();
+
+    // Before start(): record every decoded value, tagging the speed/RPM signals.
+    void setRecorder(TelemetryRecorder *recorder, int speedSignal, int rpmSignal);
+
+    // Before start(): error-frame and last-sample bookkeeping (owned by the caller)
+    void setBusCounters(CanBusCounters *counters) { m_busCounters = counters; }
+
+    // Consumer side (GUI thread)
+    bool popSample(CanSignalSample &sample) { return m_ring.pop(sample); }
+
+    quint64 framesRead() const { return m_framesRead.load(std::memory_order_relaxed); }
+    quint64 samplesQueued() const { return m_samplesQueued.load(std::memory_order_relaxed); }
+    quint64 ringOverflows() const { return m_ringOverflows.load(std::memory_order_relaxed); }
+    quint64 socketDrops() const { return m_socketDrops.load(std::memory_order_relaxed); }
+    quint64 shortReads() const { return m_shortReads.load(std::memory_order_relaxed); }
+
+    // True once run() has ended on a socket error (not on stopAndWait())
+    bool socketFailed() const { return m_socketFailed.load(std::memory_order_acquire); }
+
+protected:
+    void run() override;
+
+private:
+    static constexpr int POLL_TIMEOUT_MS = 100;
+
+    const int m_canSocket;
+    const CanSignalDecoder *m_decoder;
+    const int m_batchSize;
+    std::atomic<bool> m_stopRequested;
+    SampleRing m_ring;
+    TelemetryRecorder *m_recorder;
+    int m_speedSignal;
+    int m_rpmSignal;
+    CanBusCounters *m_busCounters;
+
+    std::atomic<quint64> m_framesRead;
+    std::atomic<quint64> m_samplesQueued;
+    std::atomic<quint64> m_ringOverflows;
+    std::atomic<quint64> m_socketDrops;     // SO_RXQ_OVFL of this thread's socket
+    std::atomic<quint64> m_shortReads;
+    std::atomic<bool> m_socketFailed;
+};
+
+#endif // CANINGESTTHREAD_H
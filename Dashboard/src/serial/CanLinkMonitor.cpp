@@ -0,0 +1,165 @@
+/**
+ * @file CanLinkMonitor.cpp
+ * @brief CAN Link Monitor Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "CanLinkMonitor.h"
+#include <QSocketNotifier>
+#include <QDebug>
+
+#include <cerrno>
+#include <cstring>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/can/netlink.h>
+
+CanLinkMonitor::CanLinkMonitor(const QString &interfaceName, QObject *parent)
+    : QObject(parent)
+    , m_interfaceName(interfaceName.toLocal8Bit())
+    , m_socket(-1)
+    , m_notifier(nullptr)
+    , m_linkUp(false)
+    , m_canState(-1)
+    , m_buffer(RECEIVE_BUFFER_SIZE, Qt::Uninitialized)
+{
+    m_socket = ::socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (m_socket < 0) {
+        qWarning() << "CAN link monitor: netlink socket failed, errno" << errno;
+        return;
+    }
+
+    struct sockaddr_nl addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK;
+    if (::bind(m_socket, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        qWarning() << "CAN link monitor: netlink bind failed, errno" << errno;
+        ::close(m_socket);
+        m_socket = -1;
+        return;
+    }
+
+    m_notifier = new QSocketNotifier(m_socket, QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &CanLinkMonitor::onReadable);
+    requestLinkState();
+}
+
+CanLinkMonitor::~CanLinkMonitor()
+{
+    if (m_notifier) {
+        m_notifier->setEnabled(false);
+    }
+    if (m_socket >= 0) {
+        ::close(m_socket);
+    }
+}
+
+void CanLinkMonitor::requestLinkState()
+{
+    struct {
+        struct nlmsghdr header;
+        struct ifinfomsg info;
+        char attributes[RTA_SPACE(IFNAMSIZ)];
+    } request;
+    std::memset(&request, 0, sizeof(request));
+
+    const size_t nameLength = qMin<size_t>(m_interfaceName.size(), IFNAMSIZ - 1) + 1;
+    struct rtattr *name = reinterpret_cast<struct rtattr *>(request.attributes);
+    name->rta_type = IFLA_IFNAME;
+    name->rta_len = RTA_LENGTH(nameLength);
+    std::memcpy(RTA_DATA(name), m_interfaceName.constData(), nameLength - 1);
+
+    request.header.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg)) + RTA_SPACE(nameLength);
+    request.header.nlmsg_type = RTM_GETLINK;
+    request.header.nlmsg_flags = NLM_F_REQUEST;
+    request.info.ifi_family = AF_UNSPEC;
+
+    if (::send(m_socket, &request, request.header.nlmsg_len, 0) < 0) {
+        qWarning() << "CAN link monitor: RTM_GETLINK failed, errno" << errno;
+    }
+}
+
+void CanLinkMonitor::onReadable()
+{
+    for (;;) {
+        const ssize_t length = ::recv(m_socket, m_buffer.data(), m_buffer.size(), 0);
+        if (length < 0) {
+            if (errno == ENOBUFS) {
+                // Events were lost while we were busy; ask for the current state.
+                requestLinkState();
+                continue;
+            }
+            return;  // EAGAIN: drained
+        }
+
+        int remaining = static_cast<int>(length);
+        for (const struct nlmsghdr *header = reinterpret_cast<const struct nlmsghdr *>(m_buffer.constData());
+             NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining)) {
+            handleMessage(header);
+        }
+    }
+}
+
+void CanLinkMonitor::handleMessage(const struct nlmsghdr *header)
+{
+    bool up = false;
+    if (header->nlmsg_type == NLMSG_ERROR) {
+        // Only our RTM_GETLINK is answered; ENODEV means the interface is missing.
+        const struct nlmsgerr *error = static_cast<const struct nlmsgerr *>(NLMSG_DATA(header));
+        if (error->error != -ENODEV) {
+            return;
+        }
+    } else if (header->nlmsg_type == RTM_NEWLINK || header->nlmsg_type == RTM_DELLINK) {
+        const struct ifinfomsg *info = static_cast<const struct ifinfomsg *>(NLMSG_DATA(header));
+        bool matches = false;
+        int canState = -1;
+        int length = IFLA_PAYLOAD(header);
+        for (const struct rtattr *attr = IFLA_RTA(info); RTA_OK(attr, length);
+             attr = RTA_NEXT(attr, length)) {
+            if (attr->rta_type == IFLA_IFNAME) {
+                matches = (qstrcmp(static_cast<const char *>(RTA_DATA(attr)),
+                                   m_interfaceName.constData()) == 0);
+            } else if (attr->rta_type == IFLA_LINKINFO) {
+                // IFLA_LINKINFO { IFLA_INFO_DATA { IFLA_CAN_STATE } }
+                int infoLength = RTA_PAYLOAD(attr);
+                for (const struct rtattr *info = static_cast<const struct rtattr *>(RTA_DATA(attr));
+                     RTA_OK(info, infoLength); info = RTA_NEXT(info, infoLength)) {
+                    if (info->rta_type != IFLA_INFO_DATA) {
+                        continue;
+                    }
+                    int dataLength = RTA_PAYLOAD(info);
+                    for (const struct rtattr *data = static_cast<const struct rtattr *>(RTA_DATA(info));
+                         RTA_OK(data, dataLength); data = RTA_NEXT(data, dataLength)) {
+                        if (data->rta_type == IFLA_CAN_STATE && RTA_PAYLOAD(data) >= sizeof(quint32)) {
+                            quint32 state = 0;
+                            std::memcpy(&state, RTA_DATA(data), sizeof(state));
+                            canState = static_cast<int>(state);
+                        }
+                    }
+                }
+            }
+        }
+        if (!matches) {
+            return;
+        }
+
+        up = header->nlmsg_type == RTM_NEWLINK &&
+             (info->ifi_flags & IFF_UP) && (info->ifi_flags & IFF_RUNNING);
+        if (canState >= 0 && canState != m_canState) {
+            m_canState = canState;
+            emit canStateChanged(canState);
+        }
+    } else {
+        return;
+    }
+
+    if (up != m_linkUp) {
+        m_linkUp = up;
+        emit linkChanged(up);
+    }
+}
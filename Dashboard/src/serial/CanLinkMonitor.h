@@ -0,0 +1,62 @@
+/**
+ * @file CanLinkMonitor.h
+ * @brief Netlink Link-state Watcher for the CAN Interface
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef CANLINKMONITOR_H
+#define CANLINKMONITOR_H
+
+#include <QObject>
+#include <QByteArray>
+
+class QSocketNotifier;
+
+/**
+ * @class CanLinkMonitor
+ * @brief Reports link up/down and CAN controller state changes of one interface
+ *
+ * Features:
+ * - NETLINK_ROUTE socket subscribed to RTMGRP_LINK, read via QSocketNotifier
+ *   (event driven, no polling)
+ * - Link up = IFF_UP and IFF_RUNNING; bus-off without auto-restart drops
+ *   the carrier, "ip link set down" clears IFF_UP, removal sends RTM_DELLINK
+ * - Controller state from IFLA_LINKINFO / IFLA_CAN_STATE when the driver
+ *   reports it (real CAN controllers; vcan has none)
+ * - Initial state requested with RTM_GETLINK when constructed
+ */
+class CanLinkMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CanLinkMonitor(const QString &interfaceName, QObject *parent = nullptr);
+    ~CanLinkMonitor();
+
+    bool isValid() const { return m_notifier != nullptr; }
+    bool isLinkUp() const { return m_linkUp; }
+    int canState() const { return m_canState; }  // enum can_state, -1 = not reported
+
+signals:
+    void linkChanged(bool up);
+    void canStateChanged(int state);
+
+private slots:
+    void onReadable();
+
+private:
+    void requestLinkState();
+    void handleMessage(const struct nlmsghdr *header);
+
+    static constexpr int RECEIVE_BUFFER_SIZE = 8192;
+
+    QByteArray m_interfaceName;
+    int m_socket;
+    QSocketNotifier *m_notifier;
+    bool m_linkUp;
+    int m_canState;
+    QByteArray m_buffer;
+};
+
+#endif // CANLINKMONITOR_H
@@ -0,0 +1,141 @@
+/**
+ * @file Ina219Device.cpp
+ * @brief INA219 Backend Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "Ina219Device.h"
+#include <QDebug>
+
+#include <cerrno>
+#include <cmath>
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+I2cIna219Device::I2cIna219Device(int bus, quint8 address)
+    : m_bus(bus)
+    , m_address(address)
+    , m_fd(-1)
+    , m_readsSinceCalibration(0)
+{
+}
+
+I2cIna219Device::~I2cIna219Device()
+{
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+QString I2cIna219Device::description() const
+{
+    return QString("/dev/i2c-%1 @ 0x%2").arg(m_bus).arg(static_cast<int>(m_address), 2, 16, QChar('0'));
+}
+
+bool I2cIna219Device::open()
+{
+    const QByteArray path = QString("/dev/i2c-%1").arg(m_bus).toLocal8Bit();
+    m_fd = ::open(path.constData(), O_RDWR | O_CLOEXEC);
+    if (m_fd < 0) {
+        qWarning() << "INA219: cannot open" << path << "errno" << errno;
+        return false;
+    }
+
+    if (!writeRegister(REG_CALIBRATION, CALIBRATION_VALUE)
+        || !writeRegister(REG_CONFIG, CONFIG_VALUE)) {
+        qWarning() << "INA219: no response at" << description();
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    return true;
+}
+
+bool I2cIna219Device::writeRegister(quint8 reg, quint16 value)
+{
+    // Registers are big-endian on the wire.
+    quint8 buffer[3] = {reg, static_cast<quint8>(value >> 8), static_cast<quint8>(value & 0xFF)};
+    struct i2c_msg msg;
+    msg.addr = m_address;
+    msg.flags = 0;
+    msg.len = sizeof(buffer);
+    msg.buf = buffer;
+
+    struct i2c_rdwr_ioctl_data transfer;
+    transfer.msgs = &msg;
+    transfer.nmsgs = 1;
+    return ::ioctl(m_fd, I2C_RDWR, &transfer) == 1;
+}
+
+bool I2cIna219Device::readRegister(quint8 reg, quint16 &value)
+{
+    // Pointer write + 2-byte read as one repeated-start transaction.
+    quint8 pointer = reg;
+    quint8 data[2] = {0, 0};
+    struct i2c_msg msgs[2];
+    msgs[0].addr = m_address;
+    msgs[0].flags = 0;
+    msgs[0].len = 1;
+    msgs[0].buf = &pointer;
+    msgs[1].addr = m_address;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].len = sizeof(data);
+    msgs[1].buf = data;
+
+    struct i2c_rdwr_ioctl_data transfer;
+    transfer.msgs = msgs;
+    transfer.nmsgs = 2;
+    if (::ioctl(m_fd, I2C_RDWR, &transfer) != 2) {
+        return false;
+    }
+    value = static_cast<quint16>((data[0] << 8) | data[1]);
+    return true;
+}
+
+bool I2cIna219Device::read(Ina219Reading &reading)
+{
+    if (m_fd < 0) {
+        return false;
+    }
+
+    if (++m_readsSinceCalibration >= CALIBRATION_REFRESH_READS) {
+        m_readsSinceCalibration = 0;
+        if (!writeRegister(REG_CALIBRATION, CALIBRATION_VALUE)) {
+            return false;
+        }
+    }
+
+    quint16 bus = 0;
+    quint16 current = 0;
+    quint16 power = 0;
+    if (!readRegister(REG_BUS_VOLTAGE, bus) || !readRegister(REG_CURRENT, current)
+        || !readRegister(REG_POWER, power)) {
+        return false;
+    }
+
+    // Bus voltage: bits 15..3, 4 mV per LSB
+    reading.voltage = (bus >> 3) * 0.004f;
+    reading.currentMa = static_cast<qint16>(current) * CURRENT_LSB_MA;
+    reading.powerW = power * POWER_LSB_W;
+    return true;
+}
+
+MockIna219Device::MockIna219Device()
+    : m_reads(0)
+{
+}
+
+bool MockIna219Device::read(Ina219Reading &reading)
+{
+    // Time base assumes ~50 Hz sampling; only the shape matters.
+    const float t = m_reads++ * 0.02f;
+    reading.voltage = 8.0f - 0.2f * std::fmod(t, 10.0f) / 10.0f
+                      - 0.01f * std::sin(t * 7.0f);
+    reading.currentMa = 150.0f + 50.0f * std::fmod(t, 5.0f) / 5.0f;
+    reading.powerW = reading.voltage * reading.currentMa / 1000.0f;
+    return true;
+}
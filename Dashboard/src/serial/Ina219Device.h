@@ -0,0 +1,103 @@
+/**
+ * @file Ina219Device.h
+ * @brief INA219 Power Monitor Backends (Linux I2C and Mock)
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef INA219DEVICE_H
+#define INA219DEVICE_H
+
+#include <QtGlobal>
+#include <QString>
+
+/**
+ * @struct Ina219Reading
+ * @brief One bus voltage / current / power measurement
+ */
+struct Ina219Reading
+{
+    float voltage;    // Bus voltage, V
+    float currentMa;  // Shunt current, mA (negative while charging)
+    float powerW;     // Power, W
+};
+
+/**
+ * @class Ina219Device
+ * @brief Backend interface used by Ina219Sampler
+ *
+ * open() runs on the caller's thread, read() only on the sampler thread.
+ */
+class Ina219Device
+{
+public:
+    virtual ~Ina219Device() = default;
+
+    virtual bool open() = 0;
+    virtual bool read(Ina219Reading &reading) = 0;
+    virtual QString description() const = 0;
+};
+
+/**
+ * @class I2cIna219Device
+ * @brief INA219 on /dev/i2c-N via I2C_RDWR ioctl
+ *
+ * Same calibration as the piracer-py driver: 32 V range, /8 gain
+ * (320 mV shunt), 0.1 mA current LSB, 2 mW power LSB (0.1 ohm shunt).
+ * PiRacer Standard uses address 0x41, PiRacer Pro 0x42.
+ */
+class I2cIna219Device : public Ina219Device
+{
+public:
+    I2cIna219Device(int bus, quint8 address);
+    ~I2cIna219Device() override;
+
+    bool open() override;
+    bool read(Ina219Reading &reading) override;
+    QString description() const override;
+
+private:
+    static constexpr quint8 REG_CONFIG = 0x00;
+    static constexpr quint8 REG_BUS_VOLTAGE = 0x02;
+    static constexpr quint8 REG_POWER = 0x03;
+    static constexpr quint8 REG_CURRENT = 0x04;
+    static constexpr quint8 REG_CALIBRATION = 0x05;
+
+    // 32 V, /8 gain, 12-bit single conversions (532 us each), continuous
+    static constexpr quint16 CONFIG_VALUE = 0x399F;
+    static constexpr quint16 CALIBRATION_VALUE = 4096;
+    static constexpr float CURRENT_LSB_MA = 0.1f;
+    static constexpr float POWER_LSB_W = 0.002f;
+    // The chip loses calibration on a brown-out; rewrite it periodically.
+    static constexpr int CALIBRATION_REFRESH_READS = 100;
+
+    bool writeRegister(quint8 reg, quint16 value);
+    bool readRegister(quint8 reg, quint16 &value);
+
+    const int m_bus;
+    const quint8 m_address;
+    int m_fd;
+    int m_readsSinceCalibration;
+};
+
+/**
+ * @class MockIna219Device
+ * @brief Synthetic 2S pack for running without hardware
+ *
+ * Produces a slowly discharging voltage with load ripple, matching the
+ * bridge's simulation mode.
+ */
+class MockIna219Device : public Ina219Device
+{
+public:
+    MockIna219Device();
+
+    bool open() override { return true; }
+    bool read(Ina219Reading &reading) override;
+    QString description() const override { return QStringLiteral("mock"); }
+
+private:
+    quint64 m_reads;
+};
+
+#endif // INA219DEVICE_H
@@ -0,0 +1,100 @@
+/**
+ * @file Ina219Sampler.cpp
+ * @brief INA219 Sampler Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "Ina219Sampler.h"
+#include "TelemetryRecorder.h"
+#include <QDebug>
+
+#include <cerrno>
+#include <time.h>
+
+namespace {
+
+constexpr qint64 NS_PER_SEC = 1000000000LL;
+
+qint64 toNs(const struct timespec &ts)
+{
+    return static_cast<qint64>(ts.tv_sec) * NS_PER_SEC + ts.tv_nsec;
+}
+
+} // namespace
+
+Ina219Sampler::Ina219Sampler(Ina219Device *device, int rateHz, QObject *parent)
+    : QThread(parent)
+    , m_device(device)
+    , m_rateHz(qBound(MIN_RATE_HZ, rateHz, MAX_RATE_HZ))
+    , m_stopRequested(false)
+    , m_recorder(nullptr)
+    , m_samplesRead(0)
+    , m_readErrors(0)
+    , m_ringOverflows(0)
+{
+}
+
+Ina219Sampler::~Ina219Sampler()
+{
+    stopAndWait();
+    delete m_device;
+}
+
+bool Ina219Sampler::startSampling()
+{
+    if (!m_device->open()) {
+        return false;
+    }
+    m_stopRequested.store(false, std::memory_order_relaxed);
+    QThread::start();
+    qDebug() << "INA219 sampling" << m_device->description() << "at" << m_rateHz << "Hz";
+    return true;
+}
+
+void Ina219Sampler::stopAndWait()
+{
+    m_stopRequested.store(true, std::memory_order_relaxed);
+    wait();
+}
+
+void Ina219Sampler::run()
+{
+    const qint64 periodNs = NS_PER_SEC / m_rateHz;
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        BatterySample sample;
+        if (m_device->read(sample.reading)) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            sample.timestampNs = toNs(now);
+            m_samplesRead.fetch_add(1, std::memory_order_relaxed);
+            if (!m_ring.push(sample)) {
+                m_ringOverflows.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (m_recorder) {
+                const qint64 wallNs = TelemetryRecorder::nowNs();
+                m_recorder->record(TelemetryRecord::KIND_BATTERY_VOLTAGE,
+                                   TelemetryRecord::SOURCE_INA219, sample.reading.voltage, wallNs);
+                m_recorder->record(TelemetryRecord::KIND_BATTERY_CURRENT_MA,
+                                   TelemetryRecord::SOURCE_INA219, sample.reading.currentMa, wallNs);
+            }
+        } else {
+            m_readErrors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Next absolute deadline; skip missed periods instead of bursting.
+        qint64 next = toNs(deadline) + periodNs;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (next < toNs(now)) {
+            next = toNs(now) + periodNs;
+        }
+        deadline.tv_sec = next / NS_PER_SEC;
+        deadline.tv_nsec = next % NS_PER_SEC;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file Ina219Sampler.h
+ * @brief Fixed-rate INA219 Sampling Thread
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef INA219SAMPLER_H
+#define INA219SAMPLER_H
+
+#include <QThread>
+#include <atomic>
+
+#include "Ina219Device.h"
+#include "SpscRing.h"
+
+class TelemetryRecorder;
+
+/**
+ * @struct BatterySample
+ * @brief Timestamped INA219 reading handed to the GUI thread
+ */
+struct BatterySample
+{
+    qint64 timestampNs;   // CLOCK_MONOTONIC
+    Ina219Reading reading;
+};
+
+/**
+ * @class Ina219Sampler
+ * @brief Reads an Ina219Device on its own thread at a fixed rate
+ *
+ * Features:
+ * - Absolute-deadline sleep (clock_nanosleep), no drift
+ * - Samples pushed into a lock-free SPSC ring, drained by the GUI frame
+ * - Read error and ring overflow counters
+ * - Optionally logs every reading to a TelemetryRecorder from the sampling thread
+ *
+ * Takes ownership of the device. startSampling() opens it on the caller's thread
+ * and only launches the thread if that succeeds.
+ */
+class Ina219Sampler : public QThread
+{
+    Q_OBJECT
+
+public:
+    static constexpr std::size_t RING_SIZE = 256;
+    static constexpr int MIN_RATE_HZ = 1;
+    static constexpr int MAX_RATE_HZ = 200;
+
+    Ina219Sampler(Ina219Device *device, int rateHz, QObject *parent = nullptr);
+    ~Ina219Sampler() override;
+
+    // Before startSampling(); the recorder must outlive the thread.
+    void setRecorder(TelemetryRecorder *recorder) { m_recorder = recorder; }
+    bool startSampling();
+    void stopAndWait();
+
+    // Consumer side (GUI thread)
+    bool popSample(BatterySample &sample) { return m_ring.pop(sample); }
+
+    int rateHz() const { return m_rateHz; }
+    QString description() const { return m_device->description(); }
+    quint64 samplesRead() const { return m_samplesRead.load(std::memory_order_relaxed); }
+    quint64 readErrors() const { return m_readErrors.load(std::memory_order_relaxed); }
+    quint64 ringOverflows() const { return m_ringOverflows.load(std::memory_order_relaxed); }
+
+protected:
+    void run() override;
+
+private:
+    Ina219Device *m_device;
+    const int m_rateHz;
+    std::atomic<bool> m_stopRequested;
+    SpscRing<BatterySample, RING_SIZE> m_ring;
+    TelemetryRecorder *m_recorder;
+
+    std::atomic<quint64> m_samplesRead;
+    std::atomic<quint64> m_readErrors;
+    std::atomic<quint64> m_ringOverflows;
+};
+
+#endif // INA219SAMPLER_H
@@ -0,0 +1,253 @@
+/**
+ * @file ReplaySource.cpp
+ * @brief Replay Source Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "ReplaySource.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+#include <QDebug>
+
+#include <algorithm>
+#include <cstring>
+
+ReplaySource::ReplaySource(const ReplayOptions &options, QObject *parent)
+    : QObject(parent)
+    , m_options(options)
+    , m_next(0)
+    , m_timer(nullptr)
+    , m_packetSequence(0)
+    , m_eventsReplayed(0)
+    , m_passes(0)
+{
+    m_timer = new QTimer(this);
+    m_timer->setSingleShot(true);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &ReplaySource::onTimer);
+}
+
+bool ReplaySource::load()
+{
+    m_events.clear();
+    for (const QString &path : m_options.files) {
+        const QString suffix = QFileInfo(path).suffix().toLower();
+        const bool ok = (suffix == "json" || suffix == "jsonl" || suffix == "ndjson")
+            ? loadJsonLines(path) : loadCandump(path);
+        if (!ok) {
+            qWarning() << "Replay: skipping" << path;
+        }
+    }
+    if (m_events.isEmpty()) {
+        return false;
+    }
+
+    // Merge sources on log time; stable so same-time frames keep file order.
+    std::stable_sort(m_events.begin(), m_events.end(),
+                     [](const Event &a, const Event &b) { return a.timeNs < b.timeNs; });
+
+    const double spanSec = (m_events.last().timeNs - m_events.first().timeNs) / 1e9;
+    qDebug() << "Replay:" << m_events.size() << "events," << spanSec << "s of log, speed"
+             << (m_options.speed > 0.0 ? QString::number(m_options.speed) + "x"
+                                       : QStringLiteral("max"));
+    return true;
+}
+
+bool ReplaySource::loadCandump(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    // candump -L: "(1697040000.123456) can0 123#0A0B0C" (CAN FD "##" and RTR skipped)
+    int loaded = 0;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine().trimmed();
+        if (line.size() < 4 || line.at(0) != '(') {
+            continue;
+        }
+        const int close = line.indexOf(')');
+        const int hash = line.indexOf('#');
+        const int idStart = line.lastIndexOf(' ', hash) + 1;
+        if (close < 0 || hash < 0 || idStart <= close || line.indexOf("##") >= 0) {
+            continue;
+        }
+
+        const QByteArray stamp = line.mid(1, close - 1);
+        const int dot = stamp.indexOf('.');
+        bool okSec = false;
+        bool okFrac = true;
+        const qint64 sec = stamp.left(dot < 0 ? stamp.size() : dot).toLongLong(&okSec);
+        qint64 fracNs = 0;
+        if (dot >= 0) {
+            const QByteArray frac = stamp.mid(dot + 1).left(9);
+            fracNs = frac.toLongLong(&okFrac);
+            for (int i = frac.size(); i < 9; ++i) {
+                fracNs *= 10;
+            }
+        }
+
+        const QByteArray idText = line.mid(idStart, hash - idStart);
+        bool okId = false;
+        quint32 canId = idText.toUInt(&okId, 16);
+        const QByteArray payload = line.mid(hash + 1);
+        if (!okSec || !okFrac || !okId || payload.startsWith('R') ||
+            payload.size() % 2 != 0 || payload.size() > 16) {
+            continue;
+        }
+        if (idText.size() > 3) {
+            canId |= 0x80000000U;  // 8-digit IDs are extended frames
+        }
+
+        Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.timeNs = sec * 1000000000LL + fracNs;
+        event.isCan = true;
+        event.canId = canId;
+        event.dlc = static_cast<quint8>(payload.size() / 2);
+        const QByteArray bytes = QByteArray::fromHex(payload);
+        std::memcpy(event.data, bytes.constData(), qMin(bytes.size(), 8));
+        m_events.append(event);
+        ++loaded;
+    }
+
+    qDebug() << "Replay:" << loaded << "CAN frames from" << path;
+    return loaded > 0;
+}
+
+bool ReplaySource::loadJsonLines(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    // Bridge stdout: one object per line; lines without a timestamp follow
+    // the previous one at the bridge's default 0.5 s interval.
+    int loaded = 0;
+    qint64 lastTimeNs = 0;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine().trimmed();
+        if (line.isEmpty() || line.at(0) != '{') {
+            continue;
+        }
+        const QJsonDocument doc = QJsonDocument::fromJson(line);
+        const QJsonObject obj = doc.object();
+        if (!obj.contains("battery")) {
+            continue;
+        }
+        const QJsonObject battery = obj["battery"].toObject();
+
+        Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.timeNs = obj.contains("timestamp")
+            ? static_cast<qint64>(obj["timestamp"].toDouble() * 1e9)
+            : lastTimeNs + 500000000LL;
+        event.isCan = false;
+        event.voltage = static_cast<float>(battery["voltage"].toDouble());
+        event.currentMa = static_cast<float>(battery["current"].toDouble());
+        event.powerW = static_cast<float>(battery["power"].toDouble());
+        event.percent = static_cast<float>(battery["percent"].toDouble());
+        lastTimeNs = event.timeNs;
+        m_events.append(event);
+        ++loaded;
+    }
+
+    qDebug() << "Replay:" << loaded << "bridge samples from" << path;
+    return loaded > 0;
+}
+
+void ReplaySource::start()
+{
+    if (m_events.isEmpty()) {
+        return;
+    }
+    m_next = 0;
+    m_passes = 1;
+    m_clock.start();
+    m_timer->start(0);
+}
+
+void ReplaySource::stop()
+{
+    m_timer->stop();
+}
+
+void ReplaySource::emitEvent(const Event &event)
+{
+    ++m_eventsReplayed;
+    if (event.isCan) {
+        emit canFrameReplayed(event.canId, event.data, event.dlc);
+        return;
+    }
+
+    TelemetryPacket packet;
+    std::memset(&packet, 0, sizeof(packet));
+    packet.magic = TelemetryPacket::MAGIC;
+    packet.version = TelemetryPacket::VERSION;
+    packet.size = sizeof(TelemetryPacket);
+    packet.sequence = m_packetSequence++;
+    packet.timestampNs = event.timeNs;
+    packet.voltage = event.voltage;
+    packet.currentMa = event.currentMa;
+    packet.powerW = event.powerW;
+    packet.percent = event.percent;
+    packet.direction = 'N';
+    emit telemetryReplayed(packet);
+}
+
+bool ReplaySource::rewind()
+{
+    const double wallSec = m_clock.nsecsElapsed() / 1e9;
+    qDebug() << "Replay pass" << m_passes << "done:" << m_events.size() << "events in"
+             << wallSec << "s (" << (wallSec > 0.0 ? m_events.size() / wallSec : 0.0)
+             << "events/s )";
+    if (!m_options.loop) {
+        return false;
+    }
+    m_next = 0;
+    ++m_passes;
+    m_clock.restart();
+    return true;
+}
+
+void ReplaySource::onTimer()
+{
+    const int count = m_events.size();
+    const qint64 logStartNs = m_events.first().timeNs;
+
+    if (m_options.speed <= 0.0) {
+        // As fast as possible, but yield so frames keep being painted.
+        const int end = qMin(count, m_next + ASAP_CHUNK);
+        while (m_next < end) {
+            emitEvent(m_events[m_next++]);
+        }
+    } else {
+        const qint64 replayNowNs =
+            logStartNs + static_cast<qint64>(m_clock.nsecsElapsed() * m_options.speed);
+        while (m_next < count && m_events[m_next].timeNs <= replayNowNs) {
+            emitEvent(m_events[m_next++]);
+        }
+    }
+
+    if (m_next >= count && !rewind()) {
+        emit finished();
+        return;
+    }
+
+    if (m_options.speed <= 0.0) {
+        m_timer->start(0);
+        return;
+    }
+    // Sleep until the next event is due on the scaled log clock.
+    const qint64 replayNowNs =
+        logStartNs + static_cast<qint64>(m_clock.nsecsElapsed() * m_options.speed);
+    const qint64 waitNs =
+        static_cast<qint64>((m_events[m_next].timeNs - replayNowNs) / m_options.speed);
+    m_timer->start(static_cast<int>(qBound<qint64>(0, waitNs / 1000000, 60000)));
+}
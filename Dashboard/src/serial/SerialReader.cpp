@@ -6,7 +6,13 @@
  */
 
 #include "SerialReader.h"
+#include "CanBatchReceiver.h"
+#include "CanIngestThread.h"
+#include "CanLinkMonitor.h"
+#include "LatencyTracer.h"
+#include "TelemetryRecorder.h"
 #include <QDebug>
+#include <QFile>
 #include <cstring>
 
 #include <sys/socket.h>
@@ -16,28 +22,110 @@
 #include <linux/can.h>
 #include <linux/can/raw.h>
 
-SerialReader::SerialReader(QObject *parent)
+SerialReader::SerialReader(const CalibrationManager &config, QObject *parent)
     : QObject(parent)
     , m_canSocket(-1)
+    , m_ingestMode(IngestMode::Notifier)
+    , m_batchSize(CanBatchReceiver::DEFAULT_BATCH_SIZE)
+    , m_batchReceiver(nullptr)
     , m_canNotifier(nullptr)
+    , m_ingestThread(nullptr)
+    , m_drainTimer(nullptr)
+    , m_frameDriven(false)
+    , m_recorder(nullptr)
     , m_reconnectTimer(nullptr)
+    , m_linkMonitor(nullptr)
     , m_isConnected(false)
+    , m_started(false)
+    , m_interfaceName(config.canInterface())
+    , m_signalDatabasePath(config.canSignalDatabase())
+    , m_canFilters(config.canFilters())
+    , m_speedSignal(-1)
+    , m_rpmSignal(-1)
+    , m_rxPacketsAtBind(0)
+    , m_framesAtBind(0)
+    , m_receiveErrors(0)
+    , m_linkDownEvents(0)
+    , m_connectCount(0)
 {
+    if (config.canIngestMode() == "thread") {
+        m_ingestMode = IngestMode::Thread;
+        qDebug() << "CAN ingest mode: dedicated reader thread";
+    }
+    m_batchSize = qBound(1, config.canBatchSize(), CanBatchReceiver::MAX_BATCH_SIZE);
+
+    // GUI-side consumer for the ingest ring
+    m_drainTimer = new QTimer(this);
+    m_drainTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_drainTimer, &QTimer::timeout,
+            this, &SerialReader::drainIngestRing);
+
     // Setup reconnect timer
     m_reconnectTimer = new QTimer(this);
     connect(m_reconnectTimer, &QTimer::timeout,
             this, &SerialReader::attemptReconnect);
+}
+
+void SerialReader::start()
+{
+    if (m_started) {
+        return;
+    }
+    m_started = true;
     
-    // Try to connect can0
+    loadSignalDatabase(m_signalDatabasePath);
+
+    // Without explicit filters, accept exactly the messages the decoder knows.
+    if (m_canFilters.isEmpty()) {
+        const QVector<quint32> ids = m_decoder.messageIds();
+        for (quint32 id : ids) {
+            const quint32 idMask = (id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK;
+            m_canFilters.append(CanFilterRule{id, CAN_EFF_FLAG | idMask});
+        }
+    }
+    
+    // Link loss and return arrive as netlink events instead of being polled.
+    m_linkMonitor = new CanLinkMonitor(m_interfaceName, this);
+    if (m_linkMonitor->isValid()) {
+        connect(m_linkMonitor, &CanLinkMonitor::linkChanged,
+                this, &SerialReader::onLinkChanged);
+        connect(m_linkMonitor, &CanLinkMonitor::canStateChanged,
+                this, &SerialReader::onCanStateChanged);
+    }
+    
+    // Try to connect the CAN interface
     if (!connectToCan()) {
-        qWarning() << "can0 not available. Will retry every 2 seconds...";
-        m_reconnectTimer->start(2000);
+        scheduleReconnect();
     }
 }
 
+void SerialReader::startReplay()
+{
+    if (m_started) {
+        return;
+    }
+    m_started = true;
+    
+    loadSignalDatabase(m_signalDatabasePath);
+    qDebug() << "CAN replay: decoding injected frames, CAN interface left untouched";
+}
+
 SerialReader::~SerialReader()
 {
     closeCan();
+    delete m_batchReceiver;
+
+    const IngestStats stats = ingestStats();
+    const FilterStats filters = filterStats();
+    qDebug() << "CAN ingest totals: frames" << stats.framesRead
+             << "injected" << stats.framesInjected
+             << "samples" << stats.samplesQueued
+             << "ring overflows" << stats.ringOverflows
+             << "socket drops" << stats.socketDrops
+             << "short reads" << stats.shortReads
+             << "| kernel filter delivered" << filters.delivered
+             << "filtered" << filters.filtered;
+    qDebug().noquote() << "CAN" << diagnostics().summary().replace('\n', QStringLiteral(", "));
 }
 
 bool SerialReader::isConnected() const
@@ -47,7 +135,111 @@ bool SerialReader::isConnected() const
 
 QString SerialReader::currentPort() const
 {
-    return m_isConnected ? QStringLiteral("can0") : QString();
+    return m_isConnected ? m_interfaceName : QString();
+}
+
+void SerialReader::loadSignalDatabase(const QString &path)
+{
+    if (path.isEmpty() || !m_decoder.loadFile(path)) {
+        if (!path.isEmpty()) {
+            qWarning() << "Falling back to built-in CAN signal layout";
+        }
+        m_decoder.loadDefaults();
+    }
+
+    m_speedSignal = m_decoder.findRole("speed_kmh");
+    m_rpmSignal = m_decoder.findRole("rpm");
+    if (m_speedSignal < 0) {
+        qWarning() << "CAN signal database has no speed_kmh signal";
+    }
+}
+
+SerialReader::IngestStats SerialReader::ingestStats() const
+{
+    IngestStats stats = m_ingestStats;
+    if (m_ingestThread) {
+        stats.framesRead += m_ingestThread->framesRead();
+        stats.samplesQueued += m_ingestThread->samplesQueued();
+        stats.ringOverflows += m_ingestThread->ringOverflows();
+        stats.socketDrops += m_ingestThread->socketDrops();
+        stats.shortReads += m_ingestThread->shortReads();
+    }
+    if (m_batchReceiver) {
+        stats.socketDrops += m_batchReceiver->socketDrops();
+        stats.shortReads += m_batchReceiver->shortReads();  // Receiver outlives sockets
+    }
+    return stats;
+}
+
+CanBusDiagnostics SerialReader::diagnostics() const
+{
+    const IngestStats stats = ingestStats();
+    CanBusDiagnostics diag;
+    diag.interfaceName = m_interfaceName;
+    diag.linkUp = (m_linkMonitor && m_linkMonitor->isValid()) ? m_linkMonitor->isLinkUp()
+                                                              : m_isConnected;
+    diag.connected = m_isConnected;
+    diag.busState = m_busCounters.state();
+    diag.framesRead = stats.framesRead;
+    diag.socketDrops = stats.socketDrops;
+    diag.ringOverflows = stats.ringOverflows;
+    diag.shortReads = stats.shortReads;
+    diag.receiveErrors = m_receiveErrors;
+    diag.errorFrames = m_busCounters.errorFrames();
+    for (int i = 0; i < CanBusCounters::ERROR_CLASS_COUNT; ++i) {
+        diag.errorClasses[i] = m_busCounters.errorClass(static_cast<CanBusCounters::ErrorClass>(i));
+    }
+    diag.linkDownEvents = m_linkDownEvents;
+    diag.reconnects = m_connectCount > 0 ? m_connectCount - 1 : 0;
+    const qint64 lastSampleNs = m_busCounters.lastSampleNs();
+    if (lastSampleNs > 0) {
+        diag.lastSampleAgeMs = qMax<qint64>(0, (CanBatchReceiver::realtimeNowNs() - lastSampleNs) / 1000000);
+    }
+    return diag;
+}
+
+SerialReader::FilterStats SerialReader::filterStats() const
+{
+    // The kernel does not count filtered frames per socket, so derive them from
+    // the interface RX counter since bind minus what this socket actually read.
+    FilterStats stats;
+    stats.delivered = ingestStats().framesRead - m_framesAtBind;
+    const quint64 rxPackets = readInterfaceRxPackets();
+    if (rxPackets >= m_rxPacketsAtBind) {
+        const quint64 seen = rxPackets - m_rxPacketsAtBind;
+        stats.filtered = (seen > stats.delivered) ? seen - stats.delivered : 0;
+    }
+    return stats;
+}
+
+quint64 SerialReader::readInterfaceRxPackets() const
+{
+    QFile counter(QStringLiteral("/sys/class/net/%1/statistics/rx_packets").arg(m_interfaceName));
+    if (!counter.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    return counter.readAll().trimmed().toULongLong();
+}
+
+bool SerialReader::installFilters()
+{
+    QVector<struct can_filter> filters;
+    filters.reserve(m_canFilters.size());
+    for (const CanFilterRule &rule : m_canFilters) {
+        struct can_filter filter;
+        filter.can_id = rule.id;
+        filter.can_mask = rule.mask;
+        filters.append(filter);
+    }
+
+    if (::setsockopt(m_canSocket, SOL_CAN_RAW, CAN_RAW_FILTER, filters.constData(),
+                     static_cast<socklen_t>(filters.size() * sizeof(struct can_filter))) < 0) {
+        qWarning() << "Failed to install CAN_RAW_FILTER, receiving all frames";
+        return false;
+    }
+
+    qDebug() << "Installed" << filters.size() << "CAN filter(s)";
+    return true;
 }
 
 bool SerialReader::connectToCan()
@@ -62,35 +254,87 @@ bool SerialReader::connectToCan()
 
     struct ifreq ifr;
     std::memset(&ifr, 0, sizeof(ifr));
-    std::strncpy(ifr.ifr_name, "can0", IFNAMSIZ - 1);
+    std::strncpy(ifr.ifr_name, m_interfaceName.toLocal8Bit().constData(), IFNAMSIZ - 1);
     if (::ioctl(m_canSocket, SIOCGIFINDEX, &ifr) < 0) {
-        qWarning() << "Failed to resolve can0 interface index";
+        qWarning() << "Failed to resolve" << m_interfaceName << "interface index";
         closeCan();
         return false;
     }
 
+    // Filter before bind so no unwanted frame is ever queued on this socket.
+    installFilters();
+    
+    // Error frames bypass the ID filters; they are counted, never decoded.
+    const can_err_mask_t errorMask = CAN_ERR_MASK;
+    if (::setsockopt(m_canSocket, SOL_CAN_RAW, CAN_RAW_ERR_FILTER,
+                     &errorMask, sizeof(errorMask)) < 0) {
+        qWarning() << "CAN_RAW_ERR_FILTER failed, bus errors will not be counted";
+    }
+
     struct sockaddr_can addr;
     std::memset(&addr, 0, sizeof(addr));
     addr.can_family = AF_CAN;
     addr.can_ifindex = ifr.ifr_ifindex;
     if (::bind(m_canSocket, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
-        qWarning() << "Failed to bind CAN socket to can0";
+        qWarning() << "Failed to bind CAN socket to" << m_interfaceName;
         closeCan();
         return false;
     }
 
-    m_canNotifier = new QSocketNotifier(m_canSocket, QSocketNotifier::Read, this);
-    connect(m_canNotifier, &QSocketNotifier::activated, this, &SerialReader::onCanReadyRead);
+    m_rxPacketsAtBind = readInterfaceRxPackets();
+    m_framesAtBind = ingestStats().framesRead;
+
+    if (!CanBatchReceiver::enableTimestamps(m_canSocket)) {
+        qWarning() << "SO_TIMESTAMPNS not supported, using userspace receive time";
+    }
+    if (!CanBatchReceiver::enableDropCounter(m_canSocket)) {
+        qWarning() << "SO_RXQ_OVFL not supported, socket drops will not be counted";
+    }
+
+    if (m_ingestMode == IngestMode::Thread) {
+        m_ingestThread = new CanIngestThread(m_canSocket, &m_decoder, m_batchSize, this);
+        m_ingestThread->setRecorder(m_recorder, m_speedSignal, m_rpmSignal);
+        m_ingestThread->setBusCounters(&m_busCounters);
+        connect(m_ingestThread, &QThread::finished,
+                this, &SerialReader::onIngestThreadFinished, Qt::QueuedConnection);
+        m_ingestThread->start(QThread::HighPriority);
+        if (!m_frameDriven) {
+            m_drainTimer->start(DRAIN_INTERVAL_MS);
+        }
+    } else {
+        if (!m_batchReceiver) {
+            m_batchReceiver = new CanBatchReceiver(m_batchSize);
+        }
+        m_canNotifier = new QSocketNotifier(m_canSocket, QSocketNotifier::Read, this);
+        connect(m_canNotifier, &QSocketNotifier::activated, this, &SerialReader::onCanReadyRead);
+    }
 
     m_isConnected = true;
+    ++m_connectCount;
     m_reconnectTimer->stop();
     emit connectionStatusChanged(true);
-    qDebug() << "Connected to can0";
+    qDebug() << "Connected to" << m_interfaceName;
     return true;
 }
 
 void SerialReader::closeCan()
 {
+    // The reader thread polls m_canSocket, so stop it before closing the fd.
+    if (m_ingestThread) {
+        m_drainTimer->stop();
+        m_ingestThread->stopAndWait();
+        m_ingestStats.framesRead += m_ingestThread->framesRead();
+        m_ingestStats.samplesQueued += m_ingestThread->samplesQueued();
+        m_ingestStats.ringOverflows += m_ingestThread->ringOverflows();
+        m_ingestStats.socketDrops += m_ingestThread->socketDrops();
+        m_ingestStats.shortReads += m_ingestThread->shortReads();
+        delete m_ingestThread;
+        m_ingestThread = nullptr;
+    }
+    if (m_batchReceiver) {
+        m_ingestStats.socketDrops += m_batchReceiver->socketDrops();
+        m_batchReceiver->resetSocketDrops();
+    }
     if (m_canNotifier) {
         m_canNotifier->setEnabled(false);
         m_canNotifier->deleteLater();
@@ -105,31 +349,194 @@ void SerialReader::closeCan()
 
 void SerialReader::onCanReadyRead()
 {
-    if (m_canSocket < 0) {
+    if (m_canSocket < 0 || !m_batchReceiver) {
         return;
     }
 
-    struct can_frame frame;
-    const ssize_t n = ::read(m_canSocket, &frame, sizeof(frame));
-    if (n < static_cast<ssize_t>(sizeof(struct can_frame))) {
+    // One wakeup drains up to m_batchSize frames in a single recvmmsg().
+    const int count = m_batchReceiver->receive(m_canSocket);
+    if (count < 0) {
+        // ENETDOWN and friends: the interface went away under the socket.
+        ++m_receiveErrors;
+        handleConnectionLost("receive error");
         return;
     }
+    if (count == 0) {
+        return;
+    }
+    m_ingestStats.framesRead += static_cast<quint64>(count);
+
+    // Decode every frame but only forward the newest value per signal.
+    CanSignalDecoder::Value values[CanSignalDecoder::MAX_VALUES_PER_FRAME];
+    float speed = 0.0f;
+    float rpm = 0.0f;
+    qint64 speedStampNs = -1;
+    qint64 rpmStampNs = -1;
+    for (int i = 0; i < count; ++i) {
+        const struct can_frame &frame = m_batchReceiver->frame(i);
+        if (frame.can_id & CAN_ERR_FLAG) {
+            m_busCounters.recordErrorFrame(frame);
+            continue;
+        }
+        const int decoded = m_decoder.decode(frame.can_id, frame.data, frame.can_dlc,
+                                             values, CanSignalDecoder::MAX_VALUES_PER_FRAME);
+        if (decoded > 0) {
+            m_busCounters.recordSample(m_batchReceiver->timestampNs(i));
+        }
+        for (int v = 0; v < decoded; ++v) {
+            TelemetryRecord::Kind kind = TelemetryRecord::KIND_CAN_SIGNAL;
+            if (values[v].signal == m_speedSignal) {
+                speed = values[v].value;
+                speedStampNs = m_batchReceiver->timestampNs(i);
+                kind = TelemetryRecord::KIND_SPEED_KMH;
+            } else if (values[v].signal == m_rpmSignal) {
+                rpm = values[v].value;
+                rpmStampNs = m_batchReceiver->timestampNs(i);
+                kind = TelemetryRecord::KIND_WHEEL_RPM;
+            }
+            if (m_recorder) {
+                m_recorder->record(kind, TelemetryRecord::SOURCE_CAN, values[v].value,
+                                   m_batchReceiver->timestampNs(i), frame.can_id);
+            }
+        }
+    }
+
+    if (speedStampNs >= 0) {
+        emit speedDataReceived(speed, speedStampNs,
+                               LatencyTracer::instance().begin(speedStampNs));
+    }
+    if (rpmStampNs >= 0) {
+        emit rpmDataReceived(rpm, rpmStampNs);
+    }
+}
+
+void SerialReader::injectFrame(quint32 canId, const quint8 *data, int dlc)
+{
+    ++m_ingestStats.framesInjected;
+
+    // The log time is in the past; the injection is this frame's "receive".
+    const qint64 nowNs = LatencyTracer::nowNs();
+    CanSignalDecoder::Value values[CanSignalDecoder::MAX_VALUES_PER_FRAME];
+    const int decoded = m_decoder.decode(canId, data, dlc,
+                                         values, CanSignalDecoder::MAX_VALUES_PER_FRAME);
+    if (decoded > 0) {
+        m_busCounters.recordSample(nowNs);
+    }
+    for (int v = 0; v < decoded; ++v) {
+        if (values[v].signal == m_speedSignal) {
+            emit speedDataReceived(values[v].value, nowNs, LatencyTracer::instance().begin(nowNs));
+        } else if (values[v].signal == m_rpmSignal) {
+            emit rpmDataReceived(values[v].value, nowNs);
+        }
+    }
+}
 
-    const quint32 canId = static_cast<quint32>(frame.can_id & CAN_EFF_MASK);
-    if (canId != SPEED_CAN_ID || frame.can_dlc < 1) {
+void SerialReader::setFrameDriven(bool frameDriven)
+{
+    m_frameDriven = frameDriven;
+    if (m_frameDriven) {
+        m_drainTimer->stop();
+    } else if (m_ingestThread) {
+        m_drainTimer->start(DRAIN_INTERVAL_MS);
+    }
+}
+
+void SerialReader::drainIngestRing()
+{
+    if (!m_ingestThread) {
         return;
     }
 
-    // candump 기준: can0 123 [8] 11 00 00 ...
-    // 첫 바이트를 km/h 속도로 사용
-    const float speedKmh = static_cast<float>(frame.data[0]);
-    emit speedDataReceived(speedKmh);
+    // Only the newest sample per signal matters for display.
+    CanSignalSample sample;
+    CanSignalSample latestSpeed{-1, -1, 0.0f};
+    CanSignalSample latestRpm{-1, -1, 0.0f};
+    while (m_ingestThread->popSample(sample)) {
+        if (sample.signal == m_speedSignal) {
+            latestSpeed = sample;
+        } else if (sample.signal == m_rpmSignal) {
+            latestRpm = sample;
+        }
+    }
+
+    if (latestSpeed.rxTimestampNs >= 0) {
+        emit speedDataReceived(latestSpeed.value, latestSpeed.rxTimestampNs,
+                               LatencyTracer::instance().begin(latestSpeed.rxTimestampNs));
+    }
+    if (latestRpm.rxTimestampNs >= 0) {
+        emit rpmDataReceived(latestRpm.value, latestRpm.rxTimestampNs);
+    }
 }
 
 void SerialReader::attemptReconnect()
 {
-    qDebug() << "Attempting to reconnect to can0...";
+    qDebug() << "Attempting to reconnect to" << m_interfaceName << "...";
     if (connectToCan()) {
-        qDebug() << "Reconnected to can0";
+        qDebug() << "Reconnected to" << m_interfaceName;
+    }
+}
+
+void SerialReader::scheduleReconnect()
+{
+    // With netlink the next link-up event reconnects; poll only without it,
+    // or when the link is up and the socket still could not be opened.
+    if (m_linkMonitor && m_linkMonitor->isValid() && !m_linkMonitor->isLinkUp()) {
+        qWarning() << m_interfaceName << "not available, waiting for the link to come up";
+        m_reconnectTimer->stop();
+        return;
+    }
+    qWarning() << m_interfaceName << "not available. Will retry every"
+               << RECONNECT_INTERVAL_MS / 1000 << "seconds...";
+    m_reconnectTimer->start(RECONNECT_INTERVAL_MS);
+}
+
+void SerialReader::handleConnectionLost(const char *reason)
+{
+    if (!m_isConnected) {
+        return;
+    }
+    qWarning() << m_interfaceName << "connection lost:" << reason;
+    closeCan();
+    emit connectionStatusChanged(false);
+    scheduleReconnect();
+}
+
+void SerialReader::onLinkChanged(bool up)
+{
+    if (!up) {
+        ++m_linkDownEvents;
+        qWarning() << m_interfaceName << "link down";
+        handleConnectionLost("link down");
+        return;
+    }
+    
+    qDebug() << m_interfaceName << "link up";
+    if (!m_isConnected) {
+        if (connectToCan()) {
+            qDebug() << "Reconnected to" << m_interfaceName;
+        } else {
+            scheduleReconnect();
+        }
+    }
+}
+
+void SerialReader::onCanStateChanged(int state)
+{
+    const CanBusState busState = (state >= 0 && state < static_cast<int>(CanBusState::Unknown))
+        ? static_cast<CanBusState>(state) : CanBusState::Unknown;
+    m_busCounters.setState(busState);
+    if (busState == CanBusState::ErrorActive) {
+        qDebug() << m_interfaceName << "controller" << CanBusCounters::stateName(busState);
+    } else {
+        qWarning() << m_interfaceName << "controller" << CanBusCounters::stateName(busState);
+    }
+}
+
+void SerialReader::onIngestThreadFinished()
+{
+    // Queued: the thread may already have been replaced by a reconnect.
+    if (m_ingestThread && m_ingestThread->socketFailed()) {
+        ++m_receiveErrors;
+        handleConnectionLost("ingest thread socket error");
     }
 }
@@ -11,45 +11,147 @@
 #include <QObject>
 #include <QTimer>
 #include <QSocketNotifier>
+#include <QVector>
+
+#include "CalibrationManager.h"
+#include "CanSignalDecoder.h"
+#include "CanBusDiagnostics.h"
+
+class CanBatchReceiver;
+class CanIngestThread;
+class CanLinkMonitor;
+class TelemetryRecorder;
 
 /**
  * @class SerialReader
  * @brief Reads speed data from can0 (SocketCAN)
  * 
  * Features:
- * - Read raw CAN frames from can0
- * - Parse speed data from CAN ID 0x123
- * - Auto-reconnection on disconnect
+ * - Read raw CAN frames from can0 (can.interface, e.g. vcan0 for soak tests)
+ * - Decode speed/RPM through the table-driven CanSignalDecoder
+ *   ("can.signal_database", built-in default: 0x123 speed, 0x124 RPM)
+ * - Link loss and return seen through netlink (CanLinkMonitor); reconnects
+ *   as soon as the link is back, 2 s polling only without netlink
+ * - Error frames (CAN_RAW_ERR_FILTER) counted per class, bus state tracked
+ * - Kernel-side CAN_RAW_FILTER set from "can.filters" in the config JSON
+ * - Batched recvmmsg() reception with kernel receive timestamps
+ * - Optional dedicated ingest thread ("can.ingest_mode": "thread")
+ * - Kernel socket queue overflows counted via SO_RXQ_OVFL
+ * - Opens a LatencyTracer trace for every speed sample handed to the GUI
+ * - Every decoded value can be logged to a TelemetryRecorder
  */
 class SerialReader : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit SerialReader(QObject *parent = nullptr);
+    enum class IngestMode {
+        Notifier,   // QSocketNotifier on the GUI thread, one read per wakeup
+        Thread      // Reader thread + SPSC ring, drained once per GUI frame
+    };
+
+    struct IngestStats {
+        quint64 framesRead = 0;     // From the CAN socket
+        quint64 framesInjected = 0; // Replay frames passed to injectFrame()
+        quint64 samplesQueued = 0;
+        quint64 ringOverflows = 0;
+        quint64 socketDrops = 0;    // SO_RXQ_OVFL: dropped on a full socket queue
+        quint64 shortReads = 0;
+    };
+
+    struct FilterStats {
+        quint64 delivered = 0;  // Frames that passed the kernel filter
+        quint64 filtered = 0;   // Frames the interface received but the filter dropped
+    };
+
+    explicit SerialReader(const CalibrationManager &config, QObject *parent = nullptr);
     ~SerialReader();
     
+    // Load the signal database and bring up can0 (or arm the reconnect timer).
+    // Kept out of the constructor so the first cluster frame does not wait on it.
+    void start();
+    
+    // Replay mode: load the signal database only; can0 is never opened and
+    // frames arrive through injectFrame().
+    void startReplay();
+    
     bool isConnected() const;
-    QString currentPort() const;  // kept for compatibility, returns "can0" when connected
+    QString currentPort() const;  // kept for compatibility, returns the interface name when connected
+    IngestMode ingestMode() const { return m_ingestMode; }
+    IngestStats ingestStats() const;
+    FilterStats filterStats() const;
+    
+    // Bus health snapshot: drops, error frames, bus state, link events,
+    // age of the newest decoded sample. Cheap enough to poll per frame.
+    CanBusDiagnostics diagnostics() const;
+    
+    // Before start(): log every decoded value (not only the forwarded ones).
+    // The recorder must outlive this reader.
+    void setRecorder(TelemetryRecorder *recorder) { m_recorder = recorder; }
+    
+    // Thread mode: let the caller's frame clock drain the ring instead of
+    // the internal 16 ms timer.
+    void setFrameDriven(bool frameDriven);
     
 signals:
-    void speedDataReceived(float pulsePerSec);
+    // rxTimestampNs: kernel receive time of the frame (CLOCK_REALTIME, ns)
+    // traceId: LatencyTracer trace opened when the sample was dequeued
+    void speedDataReceived(float pulsePerSec, qint64 rxTimestampNs, quint32 traceId);
+    void rpmDataReceived(float rpm, qint64 rxTimestampNs);
     void connectionStatusChanged(bool connected);
     
+public slots:
+    // Forward the newest queued sample per signal (thread mode only)
+    void drainIngestRing();
+    
+    // Decode one recorded frame as if it had just been received
+    void injectFrame(quint32 canId, const quint8 *data, int dlc);
+    
 private slots:
     void onCanReadyRead();
     void attemptReconnect();
+    void onLinkChanged(bool up);
+    void onCanStateChanged(int state);
+    void onIngestThreadFinished();
     
 private:
     bool connectToCan();
     void closeCan();
+    void handleConnectionLost(const char *reason);
+    void scheduleReconnect();
+    bool installFilters();
+    quint64 readInterfaceRxPackets() const;
+    void loadSignalDatabase(const QString &path);
     
-    static constexpr quint32 SPEED_CAN_ID = 0x123;
+    static constexpr int DRAIN_INTERVAL_MS = 16;  // ~60 FPS
+    static constexpr int RECONNECT_INTERVAL_MS = 2000;  // Fallback poll: no netlink, or link up but open failed
 
     int m_canSocket;
+    IngestMode m_ingestMode;
+    int m_batchSize;
+    CanBatchReceiver *m_batchReceiver;
     QSocketNotifier *m_canNotifier;
+    CanIngestThread *m_ingestThread;
+    QTimer *m_drainTimer;
+    bool m_frameDriven;
+    TelemetryRecorder *m_recorder;
     QTimer *m_reconnectTimer;
+    CanLinkMonitor *m_linkMonitor;
+    CanBusCounters m_busCounters;
     bool m_isConnected;
+    bool m_started;
+    QString m_interfaceName;
+    QString m_signalDatabasePath;
+    QVector<CanFilterRule> m_canFilters;
+    CanSignalDecoder m_decoder;
+    int m_speedSignal;
+    int m_rpmSignal;
+    IngestStats m_ingestStats;   // Notifier path, injected frames, threads torn down on reconnect
+    quint64 m_rxPacketsAtBind;
+    quint64 m_framesAtBind;
+    quint64 m_receiveErrors;
+    quint64 m_linkDownEvents;
+    quint64 m_connectCount;
 };
 
 #endif // SERIALREADER_H
@@ -0,0 +1,49 @@
+/**
+ * @file TelemetryPacket.h
+ * @brief Fixed-layout Binary Telemetry Datagram (bridge -> dashboard)
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef TELEMETRYPACKET_H
+#define TELEMETRYPACKET_H
+
+#include <QtGlobal>
+#include <cstddef>
+
+/**
+ * @struct TelemetryPacket
+ * @brief One battery/direction sample, sent as a single Unix datagram
+ *
+ * Little-endian, naturally aligned, 48 bytes. The Python writer packs the
+ * same layout with struct format "<IHHIIqffffB7x"; bump VERSION on any
+ * layout change.
+ */
+struct TelemetryPacket
+{
+    static constexpr quint32 MAGIC = 0x4D545250;   // "PRTM"
+    static constexpr quint16 VERSION = 1;
+
+    quint32 magic;
+    quint16 version;
+    quint16 size;           // sizeof(TelemetryPacket) as seen by the writer
+    quint32 sequence;       // Incremented per packet; gaps = drops
+    quint32 flags;          // FLAG_* bits
+    qint64 timestampNs;     // Writer CLOCK_REALTIME, ns
+    float voltage;          // V
+    float currentMa;        // mA
+    float powerW;           // W
+    float percent;          // Battery SOC, %
+    quint8 direction;       // 'F', 'R' or 'N'
+    quint8 reserved[7];
+
+    enum Flags : quint32 {
+        FLAG_SIMULATED = 1u << 0   // Writer has no hardware, values are synthetic
+    };
+};
+
+static_assert(sizeof(TelemetryPacket) == 48, "TelemetryPacket layout is part of the wire format");
+static_assert(offsetof(TelemetryPacket, timestampNs) == 16, "TelemetryPacket layout drifted");
+static_assert(offsetof(TelemetryPacket, direction) == 40, "TelemetryPacket layout drifted");
+
+#endif // TELEMETRYPACKET_H
@@ -0,0 +1,125 @@
+/**
+ * @file TelemetrySocket.cpp
+ * @brief Telemetry Socket Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "TelemetrySocket.h"
+#include <QSocketNotifier>
+#include <QDebug>
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+TelemetrySocket::TelemetrySocket(const QString &path, QObject *parent)
+    : QObject(parent)
+    , m_path(path)
+    , m_socket(-1)
+    , m_notifier(nullptr)
+    , m_lastSequence(0)
+    , m_haveSequence(false)
+{
+    if (!open()) {
+        qWarning() << "Telemetry socket unavailable:" << m_path;
+    }
+}
+
+TelemetrySocket::~TelemetrySocket()
+{
+    close();
+    qDebug() << "Telemetry: received" << m_stats.received
+             << "rejected" << m_stats.rejected
+             << "sequence gaps" << m_stats.sequenceGaps;
+}
+
+bool TelemetrySocket::open()
+{
+    const QByteArray pathBytes = m_path.toLocal8Bit();
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (pathBytes.size() >= static_cast<int>(sizeof(addr.sun_path))) {
+        qWarning() << "Telemetry socket path too long:" << m_path;
+        return false;
+    }
+    std::memcpy(addr.sun_path, pathBytes.constData(), pathBytes.size());
+
+    m_socket = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        qWarning() << "Failed to create telemetry socket, errno" << errno;
+        return false;
+    }
+
+    // A previous run may have left the socket file behind.
+    ::unlink(addr.sun_path);
+    if (::bind(m_socket, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        qWarning() << "Failed to bind telemetry socket, errno" << errno;
+        close();
+        return false;
+    }
+
+    m_notifier = new QSocketNotifier(m_socket, QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &TelemetrySocket::onReadyRead);
+    qDebug() << "Telemetry socket listening on" << m_path;
+    return true;
+}
+
+void TelemetrySocket::close()
+{
+    if (m_notifier) {
+        m_notifier->setEnabled(false);
+        m_notifier->deleteLater();
+        m_notifier = nullptr;
+    }
+    if (m_socket >= 0) {
+        ::close(m_socket);
+        m_socket = -1;
+        ::unlink(m_path.toLocal8Bit().constData());
+    }
+}
+
+void TelemetrySocket::onReadyRead()
+{
+    TelemetryPacket packet;
+    TelemetryPacket latest;
+    bool haveLatest = false;
+
+    for (;;) {
+        const ssize_t n = ::recv(m_socket, &packet, sizeof(packet), MSG_DONTWAIT | MSG_TRUNC);
+        if (n < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                qWarning() << "Telemetry receive failed, errno" << errno;
+            }
+            if (errno != EINTR) {
+                break;
+            }
+            continue;
+        }
+
+        // MSG_TRUNC reports the real datagram length, so oversize packets are caught too.
+        if (n != static_cast<ssize_t>(sizeof(packet)) || packet.magic != TelemetryPacket::MAGIC
+            || packet.version != TelemetryPacket::VERSION || packet.size != sizeof(packet)) {
+            ++m_stats.rejected;
+            continue;
+        }
+
+        if (m_haveSequence && packet.sequence != m_lastSequence + 1
+            && packet.sequence > m_lastSequence) {
+            m_stats.sequenceGaps += packet.sequence - m_lastSequence - 1;
+        }
+        m_lastSequence = packet.sequence;
+        m_haveSequence = true;
+        ++m_stats.received;
+
+        latest = packet;
+        haveLatest = true;
+    }
+
+    if (haveLatest) {
+        emit telemetryReceived(latest);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file TelemetrySocket.h
+ * @brief Unix Datagram Receiver for Bridge Telemetry
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef TELEMETRYSOCKET_H
+#define TELEMETRYSOCKET_H
+
+#include <QObject>
+#include <QString>
+#include "TelemetryPacket.h"
+
+class QSocketNotifier;
+
+/**
+ * @class TelemetrySocket
+ * @brief Binds a SOCK_DGRAM Unix socket and receives TelemetryPacket samples
+ *
+ * Features:
+ * - Datagrams are received straight into a TelemetryPacket (no parsing)
+ * - Drains every queued datagram per wakeup, forwards only the newest
+ * - Rejects wrong magic/version/size, counts sequence gaps
+ *
+ * The dashboard owns the socket path; the bridge just sendto()s it.
+ */
+class TelemetrySocket : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Stats {
+        quint64 received = 0;
+        quint64 rejected = 0;      // Bad magic/version/size
+        quint64 sequenceGaps = 0;  // Packets the writer sent that never arrived
+    };
+
+    explicit TelemetrySocket(const QString &path = QStringLiteral("/tmp/piracer_telemetry.sock"),
+                             QObject *parent = nullptr);
+    ~TelemetrySocket();
+
+    bool isOpen() const { return m_socket >= 0; }
+    QString path() const { return m_path; }
+    Stats stats() const { return m_stats; }
+
+signals:
+    void telemetryReceived(const TelemetryPacket &packet);
+
+private slots:
+    void onReadyRead();
+
+private:
+    bool open();
+    void close();
+
+    QString m_path;
+    int m_socket;
+    QSocketNotifier *m_notifier;
+    Stats m_stats;
+    quint32 m_lastSequence;
+    bool m_haveSequence;
+};
+
+#endif // TELEMETRYSOCKET_H
@@ -6,19 +6,93 @@
  */
 
 #include "CalibrationManager.h"
+#include <QCoreApplication>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QDebug>
 
+#include <cmath>
+
 CalibrationManager::CalibrationManager()
     : m_speedCalibration(0.72f)
     , m_pulsesPerRevolution(20)
     , m_batteryVMin(6.4f)
     , m_batteryVMax(8.4f)
+    , m_batterySource("i2c")
+    , m_batteryI2cBus(1)
+    , m_batteryI2cAddress(0x41)
+    , m_batterySampleRateHz(50)
+    , m_batteryCapacityMah(2500.0f)
+    , m_batterySocAlpha(0.12f)
+    , m_canInterface("can0")
+    , m_canIngestMode("notifier")
+    , m_canBatchSize(16)
+    , m_displayTargetFps(60)
+    , m_speedNeedleResponseMs(220)
+    , m_rpmNeedleResponseMs(180)
+    , m_telemetryTransport("uds")
+    , m_telemetrySocketPath("/tmp/piracer_telemetry.sock")
+    , m_startupStaged(true)
+    , m_debugLatencyOverlay(false)
+    , m_debugLatencyDumpPath("/tmp/piracer_latency.txt")
+    , m_recorderEnabled(true)
+    , m_recorderPath("/var/tmp/piracer_telemetry.ring")
+    , m_recorderRetentionSec(300)
+    , m_recorderMaxRateHz(1000)
 {
 }
 
+QString CalibrationManager::findConfigFile()
+{
+    const QString appDir = QCoreApplication::applicationDirPath();
+    const QStringList candidateConfigs = {
+        "config/calibration.json",
+        QDir::cleanPath(appDir + "/config/calibration.json"),
+        QDir::cleanPath(appDir + "/../config/calibration.json"),
+        QDir::cleanPath(appDir + "/../../config/calibration.json")
+    };
+
+    for (const QString &candidate : candidateConfigs) {
+        if (QFileInfo::exists(candidate)) {
+            return candidate;
+        }
+    }
+    return QString();
+}
+
+bool CalibrationManager::parseUnsigned(const QJsonValue &value, quint32 *result)
+{
+    // Accept both numbers and hex strings ("0x123") since IDs are usually written in hex.
+    // Unsigned 32-bit: 29-bit IDs with CAN_EFF_FLAG do not fit in an int.
+    if (value.isDouble()) {
+        const double number = value.toDouble();
+        if (number < 0.0 || number > 4294967295.0 || std::floor(number) != number) {
+            return false;
+        }
+        *result = static_cast<quint32>(number);
+        return true;
+    }
+    if (value.isString()) {
+        bool ok = false;
+        const quint32 parsed = value.toString().trimmed().toUInt(&ok, 0);
+        if (ok) {
+            *result = parsed;
+        }
+        return ok;
+    }
+    return false;
+}
+
+quint32 CalibrationManager::parseHexValue(const QJsonValue &value, quint32 fallback)
+{
+    quint32 parsed = 0;
+    return parseUnsigned(value, &parsed) ? parsed : fallback;
+}
+
 bool CalibrationManager::load(const QString &filename)
 {
     QFile file(filename);
@@ -55,6 +129,85 @@ bool CalibrationManager::load(const QString &filename)
         QJsonObject battery = root["battery"].toObject();
         m_batteryVMin = battery["v_min"].toDouble(6.4);
         m_batteryVMax = battery["v_max"].toDouble(8.4);
+        m_batterySource = battery["source"].toString("i2c");
+        m_batteryI2cBus = battery["i2c_bus"].toInt(1);
+        m_batteryI2cAddress = static_cast<quint8>(parseHexValue(battery["i2c_address"], 0x41));
+        m_batterySampleRateHz = battery["sample_rate_hz"].toInt(50);
+        m_batteryCapacityMah = battery["capacity_mah"].toDouble(2500.0);
+        m_batterySocAlpha = battery["soc_alpha"].toDouble(0.12);
+    }
+    
+    // Load CAN ingest settings
+    if (root.contains("can")) {
+        QJsonObject can = root["can"].toObject();
+        m_canInterface = can["interface"].toString("can0");
+        m_canIngestMode = can["ingest_mode"].toString("notifier");
+        m_canBatchSize = can["batch_size"].toInt(16);
+        
+        // Relative paths are resolved against the config file's directory.
+        const QString database = can["signal_database"].toString();
+        if (!database.isEmpty()) {
+            m_canSignalDatabase = QFileInfo(database).isAbsolute()
+                ? database
+                : QFileInfo(filename).dir().filePath(database);
+        }
+        
+        m_canFilters.clear();
+        const QJsonArray filters = can["filters"].toArray();
+        for (const QJsonValue &entry : filters) {
+            const QJsonObject filter = entry.toObject();
+            CanFilterRule rule;
+            if (!parseUnsigned(filter["id"], &rule.id)) {
+                qWarning() << "Ignoring CAN filter with invalid id:" << filter["id"];
+                continue;
+            }
+            if (!filter.contains("mask")) {
+                // Exact ID match, standard and extended frames kept apart
+                const bool extended = (rule.id & 0x80000000U) != 0;
+                rule.mask = 0x80000000U | (extended ? 0x1FFFFFFFU : 0x7FFU);
+            } else if (!parseUnsigned(filter["mask"], &rule.mask)) {
+                qWarning() << "Ignoring CAN filter with invalid mask:" << filter["mask"];
+                continue;
+            }
+            m_canFilters.append(rule);
+        }
+    }
+    
+    // Load display settings
+    if (root.contains("display")) {
+        QJsonObject display = root["display"].toObject();
+        m_displayTargetFps = display["target_fps"].toInt(60);
+        m_speedNeedleResponseMs = display["speed_needle_response_ms"].toInt(220);
+        m_rpmNeedleResponseMs = display["rpm_needle_response_ms"].toInt(180);
+    }
+    
+    // Load bridge telemetry transport
+    if (root.contains("telemetry")) {
+        QJsonObject telemetry = root["telemetry"].toObject();
+        m_telemetryTransport = telemetry["transport"].toString("uds");
+        m_telemetrySocketPath = telemetry["socket_path"].toString("/tmp/piracer_telemetry.sock");
+    }
+    
+    // Load startup sequencing
+    if (root.contains("startup")) {
+        QJsonObject startup = root["startup"].toObject();
+        m_startupStaged = startup["staged"].toBool(true);
+    }
+    
+    // Load debug instrumentation
+    if (root.contains("debug")) {
+        QJsonObject debug = root["debug"].toObject();
+        m_debugLatencyOverlay = debug["latency_overlay"].toBool(false);
+        m_debugLatencyDumpPath = debug["latency_dump_path"].toString("/tmp/piracer_latency.txt");
+    }
+    
+    // Load telemetry recorder
+    if (root.contains("recorder")) {
+        QJsonObject recorder = root["recorder"].toObject();
+        m_recorderEnabled = recorder["enabled"].toBool(true);
+        m_recorderPath = recorder["path"].toString("/var/tmp/piracer_telemetry.ring");
+        m_recorderRetentionSec = recorder["retention_s"].toInt(300);
+        m_recorderMaxRateHz = recorder["max_rate_hz"].toInt(1000);
     }
     
     qDebug() << "Calibration loaded successfully from" << filename;
@@ -83,8 +236,64 @@ bool CalibrationManager::save(const QString &filename) const
     battery["v_max"] = m_batteryVMax;
     battery["cells"] = 2;
     battery["type"] = "LiPo 2S";
+    battery["source"] = m_batterySource;
+    battery["i2c_bus"] = m_batteryI2cBus;
+    battery["i2c_address"] = "0x" + QString::number(m_batteryI2cAddress, 16).toUpper();
+    battery["sample_rate_hz"] = m_batterySampleRateHz;
+    battery["capacity_mah"] = m_batteryCapacityMah;
+    battery["soc_alpha"] = m_batterySocAlpha;
     root["battery"] = battery;
     
+    // CAN ingest settings
+    QJsonObject can;
+    can["interface"] = m_canInterface;
+    can["ingest_mode"] = m_canIngestMode;
+    can["batch_size"] = m_canBatchSize;
+    if (!m_canSignalDatabase.isEmpty()) {
+        can["signal_database"] = QFileInfo(filename).dir().relativeFilePath(m_canSignalDatabase);
+    }
+    QJsonArray filters;
+    for (const CanFilterRule &rule : m_canFilters) {
+        QJsonObject filter;
+        filter["id"] = "0x" + QString::number(rule.id, 16).toUpper();
+        filter["mask"] = "0x" + QString::number(rule.mask, 16).toUpper();
+        filters.append(filter);
+    }
+    can["filters"] = filters;
+    root["can"] = can;
+    
+    // Display settings
+    QJsonObject display;
+    display["target_fps"] = m_displayTargetFps;
+    display["speed_needle_response_ms"] = m_speedNeedleResponseMs;
+    display["rpm_needle_response_ms"] = m_rpmNeedleResponseMs;
+    root["display"] = display;
+    
+    // Bridge telemetry transport
+    QJsonObject telemetry;
+    telemetry["transport"] = m_telemetryTransport;
+    telemetry["socket_path"] = m_telemetrySocketPath;
+    root["telemetry"] = telemetry;
+    
+    // Startup sequencing
+    QJsonObject startup;
+    startup["staged"] = m_startupStaged;
+    root["startup"] = startup;
+    
+    // Debug instrumentation
+    QJsonObject debug;
+    debug["latency_overlay"] = m_debugLatencyOverlay;
+    debug["latency_dump_path"] = m_debugLatencyDumpPath;
+    root["debug"] = debug;
+    
+    // Telemetry recorder
+    QJsonObject recorder;
+    recorder["enabled"] = m_recorderEnabled;
+    recorder["path"] = m_recorderPath;
+    recorder["retention_s"] = m_recorderRetentionSec;
+    recorder["max_rate_hz"] = m_recorderMaxRateHz;
+    root["recorder"] = recorder;
+    
     root["version"] = "1.0";
     
     QJsonDocument doc(root);
@@ -9,6 +9,24 @@
 #define CALIBRATIONMANAGER_H
 
 #include <QString>
+#include <QVector>
+
+class QJsonValue;
+
+/**
+ * @struct CanFilterRule
+ * @brief One CAN_RAW_FILTER entry: a frame passes when (can_id & mask) == (id & mask)
+ *
+ * IDs and masks use the Linux can_id layout, so the mask needs CAN_EFF_FLAG
+ * (0x80000000) to tell 11-bit from 29-bit frames: "0x800007FF" matches only
+ * standard frames, a plain "0x7FF" also matches extended IDs with the same
+ * low 11 bits.
+ */
+struct CanFilterRule
+{
+    quint32 id;
+    quint32 mask;
+};
 
 /**
  * @class CalibrationManager
@@ -22,23 +40,98 @@ public:
     bool load(const QString &filename);
     bool save(const QString &filename) const;
     
+    // Locate config/calibration.json in the common runtime locations
+    static QString findConfigFile();
+    
     // Getters
     float speedCalibration() const { return m_speedCalibration; }
     int pulsesPerRevolution() const { return m_pulsesPerRevolution; }
     float batteryVMin() const { return m_batteryVMin; }
     float batteryVMax() const { return m_batteryVMax; }
+    QString batterySource() const { return m_batterySource; }
+    int batteryI2cBus() const { return m_batteryI2cBus; }
+    quint8 batteryI2cAddress() const { return m_batteryI2cAddress; }
+    int batterySampleRateHz() const { return m_batterySampleRateHz; }
+    float batteryCapacityMah() const { return m_batteryCapacityMah; }
+    float batterySocAlpha() const { return m_batterySocAlpha; }
+    QString canInterface() const { return m_canInterface; }
+    QString canIngestMode() const { return m_canIngestMode; }
+    int canBatchSize() const { return m_canBatchSize; }
+    QVector<CanFilterRule> canFilters() const { return m_canFilters; }
+    QString canSignalDatabase() const { return m_canSignalDatabase; }
+    int displayTargetFps() const { return m_displayTargetFps; }
+    int speedNeedleResponseMs() const { return m_speedNeedleResponseMs; }
+    int rpmNeedleResponseMs() const { return m_rpmNeedleResponseMs; }
+    QString telemetryTransport() const { return m_telemetryTransport; }
+    QString telemetrySocketPath() const { return m_telemetrySocketPath; }
+    bool startupStaged() const { return m_startupStaged; }
+    bool debugLatencyOverlay() const { return m_debugLatencyOverlay; }
+    QString debugLatencyDumpPath() const { return m_debugLatencyDumpPath; }
+    bool recorderEnabled() const { return m_recorderEnabled; }
+    QString recorderPath() const { return m_recorderPath; }
+    int recorderRetentionSec() const { return m_recorderRetentionSec; }
+    int recorderMaxRateHz() const { return m_recorderMaxRateHz; }
     
     // Setters
     void setSpeedCalibration(float value) { m_speedCalibration = value; }
     void setPulsesPerRevolution(int value) { m_pulsesPerRevolution = value; }
     void setBatteryVMin(float value) { m_batteryVMin = value; }
     void setBatteryVMax(float value) { m_batteryVMax = value; }
+    void setBatterySource(const QString &source) { m_batterySource = source; }
+    void setBatteryI2cBus(int bus) { m_batteryI2cBus = bus; }
+    void setBatteryI2cAddress(quint8 address) { m_batteryI2cAddress = address; }
+    void setBatterySampleRateHz(int hz) { m_batterySampleRateHz = hz; }
+    void setBatteryCapacityMah(float value) { m_batteryCapacityMah = value; }
+    void setBatterySocAlpha(float value) { m_batterySocAlpha = value; }
+    void setCanInterface(const QString &name) { m_canInterface = name; }
+    void setCanIngestMode(const QString &mode) { m_canIngestMode = mode; }
+    void setCanBatchSize(int value) { m_canBatchSize = value; }
+    void setCanFilters(const QVector<CanFilterRule> &filters) { m_canFilters = filters; }
+    void setCanSignalDatabase(const QString &path) { m_canSignalDatabase = path; }
+    void setDisplayTargetFps(int fps) { m_displayTargetFps = fps; }
+    void setSpeedNeedleResponseMs(int ms) { m_speedNeedleResponseMs = ms; }
+    void setRpmNeedleResponseMs(int ms) { m_rpmNeedleResponseMs = ms; }
+    void setTelemetryTransport(const QString &transport) { m_telemetryTransport = transport; }
+    void setTelemetrySocketPath(const QString &path) { m_telemetrySocketPath = path; }
+    void setStartupStaged(bool staged) { m_startupStaged = staged; }
+    void setDebugLatencyOverlay(bool enabled) { m_debugLatencyOverlay = enabled; }
+    void setDebugLatencyDumpPath(const QString &path) { m_debugLatencyDumpPath = path; }
+    void setRecorderEnabled(bool enabled) { m_recorderEnabled = enabled; }
+    void setRecorderPath(const QString &path) { m_recorderPath = path; }
+    void setRecorderRetentionSec(int seconds) { m_recorderRetentionSec = seconds; }
+    void setRecorderMaxRateHz(int hz) { m_recorderMaxRateHz = hz; }
     
 private:
+    static bool parseUnsigned(const QJsonValue &value, quint32 *result);
+    static quint32 parseHexValue(const QJsonValue &value, quint32 fallback);
+    
     float m_speedCalibration;
     int m_pulsesPerRevolution;
     float m_batteryVMin;
     float m_batteryVMax;
+    QString m_batterySource;
+    int m_batteryI2cBus;
+    quint8 m_batteryI2cAddress;
+    int m_batterySampleRateHz;
+    float m_batteryCapacityMah;
+    float m_batterySocAlpha;
+    QString m_canInterface;
+    QString m_canIngestMode;
+    int m_canBatchSize;
+    QVector<CanFilterRule> m_canFilters;
+    QString m_canSignalDatabase;
+    int m_displayTargetFps;
+    int m_speedNeedleResponseMs;
+    int m_rpmNeedleResponseMs;
+    QString m_telemetryTransport;
+    QString m_telemetrySocketPath;
+    bool m_startupStaged;
+    bool m_debugLatencyOverlay;
+    QString m_debugLatencyDumpPath;
+    bool m_recorderEnabled;
+    QString m_recorderPath;
+    int m_recorderRetentionSec;
+    int m_recorderMaxRateHz;
 };
 
 #endif // CALIBRATIONMANAGER_H
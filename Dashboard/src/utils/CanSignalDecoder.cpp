@@ -0,0 +1,415 @@
+/**
+ * @file CanSignalDecoder.cpp
+ * @brief CAN Signal Decoder Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "CanSignalDecoder.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QDebug>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr quint32 SFF_MASK = 0x000007FFU;
+constexpr quint32 EFF_MASK = 0x1FFFFFFFU;
+
+quint32 parseId(const QJsonValue &value)
+{
+    if (value.isDouble()) {
+        return static_cast<quint32>(value.toDouble());
+    }
+    bool ok = false;
+    const quint32 id = value.toString().trimmed().toUInt(&ok, 0);
+    return ok ? id : 0;
+}
+
+} // namespace
+
+CanSignalDecoder::CanSignalDecoder()
+    : m_sffTable(SFF_TABLE_SIZE, -1)
+{
+}
+
+quint32 CanSignalDecoder::normalizeId(quint32 canId)
+{
+    // Drop RTR/ERR flags; keep EFF so 0x123 and extended 0x123 stay distinct.
+    if (canId & EFF_FLAG) {
+        return EFF_FLAG | (canId & EFF_MASK);
+    }
+    return canId & SFF_MASK;
+}
+
+void CanSignalDecoder::clear()
+{
+    m_signals.clear();
+    m_extractors.clear();
+    rebuildTables();
+}
+
+bool CanSignalDecoder::addSignal(const Signal &signal)
+{
+    const bool ok = appendSignal(signal);
+    rebuildTables();
+    return ok;
+}
+
+bool CanSignalDecoder::appendSignal(const Signal &signal)
+{
+    if (signal.length < 1 || signal.length > 64) {
+        qWarning() << "CAN signal" << signal.name << "has invalid length" << signal.length;
+        return false;
+    }
+    if (signal.floatBits != 0 && signal.floatBits != signal.length) {
+        qWarning() << "CAN signal" << signal.name << "float width does not match length";
+        return false;
+    }
+
+    Extractor x;
+    x.mask = (signal.length == 64) ? ~0ULL : ((1ULL << signal.length) - 1ULL);
+    x.bigEndian = !signal.littleEndian;
+    x.isSigned = signal.isSigned;
+    x.floatBits = static_cast<quint8>(signal.floatBits);
+    x.length = static_cast<quint8>(signal.length);
+    x.factor = signal.factor;
+    x.offset = signal.offset;
+
+    if (signal.littleEndian) {
+        // Intel: start bit is the LSB in the little-endian 64-bit payload word.
+        const int lastBit = signal.startBit + signal.length - 1;
+        if (signal.startBit < 0 || lastBit > 63) {
+            qWarning() << "CAN signal" << signal.name << "does not fit in 8 bytes";
+            return false;
+        }
+        x.shift = static_cast<quint8>(signal.startBit);
+        x.bytesNeeded = static_cast<quint8>(lastBit / 8 + 1);
+    } else {
+        // Motorola: start bit is the MSB in DBC sawtooth numbering. Convert to a
+        // linear MSB-first position and shift from the big-endian payload word.
+        const int msbLinear = (signal.startBit / 8) * 8 + (7 - signal.startBit % 8);
+        const int lsbLinear = msbLinear + signal.length - 1;
+        if (signal.startBit < 0 || lsbLinear > 63) {
+            qWarning() << "CAN signal" << signal.name << "does not fit in 8 bytes";
+            return false;
+        }
+        x.shift = static_cast<quint8>(63 - lsbLinear);
+        x.bytesNeeded = static_cast<quint8>(lsbLinear / 8 + 1);
+    }
+
+    if (signal.minDlc < 0 || signal.minDlc > 8) {
+        qWarning() << "CAN signal" << signal.name << "has invalid minimum DLC" << signal.minDlc;
+        return false;
+    }
+    if (signal.minDlc > 0 && signal.minDlc < x.bytesNeeded) {
+        // Opted in: shorter frames decode, missing bytes read as zero
+        x.bytesNeeded = static_cast<quint8>(signal.minDlc);
+    }
+
+    Signal stored = signal;
+    stored.canId = normalizeId(signal.canId);
+    m_signals.append(stored);
+    m_extractors.append(x);
+    return true;
+}
+
+void CanSignalDecoder::rebuildTables()
+{
+    m_order.resize(m_signals.size());
+    for (int i = 0; i < m_signals.size(); ++i) {
+        m_order[i] = i;
+    }
+    std::stable_sort(m_order.begin(), m_order.end(), [this](int a, int b) {
+        return m_signals[a].canId < m_signals[b].canId;
+    });
+
+    m_messages.clear();
+    m_sffTable.fill(-1);
+    m_effTable.clear();
+    for (int i = 0; i < m_order.size(); ++i) {
+        const quint32 id = m_signals[m_order[i]].canId;
+        if (m_messages.isEmpty() || m_messages.last().canId != id) {
+            m_messages.append(Message{id, i, 0});
+            const int messageIndex = m_messages.size() - 1;
+            if (id & EFF_FLAG) {
+                m_effTable.insert(id, messageIndex);
+            } else {
+                m_sffTable[static_cast<int>(id)] = static_cast<qint16>(messageIndex);
+            }
+        }
+        ++m_messages.last().count;
+    }
+}
+
+int CanSignalDecoder::lookupMessage(quint32 key) const
+{
+    if (!(key & EFF_FLAG)) {
+        return m_sffTable[static_cast<int>(key)];
+    }
+    return m_effTable.value(key, -1);
+}
+
+int CanSignalDecoder::decode(quint32 canId, const quint8 *data, int dlc,
+                             Value *out, int maxValues) const
+{
+    const int messageIndex = lookupMessage(normalizeId(canId));
+    if (messageIndex < 0) {
+        return 0;
+    }
+
+    dlc = qBound(0, dlc, 8);
+    quint64 le = 0;
+    quint64 be = 0;
+    for (int i = 0; i < 8; ++i) {
+        const quint64 byte = (i < dlc) ? data[i] : 0;
+        le |= byte << (8 * i);
+        be = (be << 8) | byte;
+    }
+
+    const Message &message = m_messages[messageIndex];
+    int written = 0;
+    for (int n = 0; n < message.count && written < maxValues; ++n) {
+        const int signalIndex = m_order[message.first + n];
+        const Extractor &x = m_extractors[signalIndex];
+        if (dlc < x.bytesNeeded) {
+            continue;
+        }
+
+        const quint64 raw = ((x.bigEndian ? be : le) >> x.shift) & x.mask;
+        double physical;
+        if (x.floatBits == 32) {
+            const quint32 bits = static_cast<quint32>(raw);
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            physical = f;
+        } else if (x.floatBits == 64) {
+            double d;
+            std::memcpy(&d, &raw, sizeof(d));
+            physical = d;
+        } else if (x.isSigned && x.length < 64 && (raw >> (x.length - 1)) & 1ULL) {
+            physical = static_cast<double>(static_cast<qint64>(raw | ~x.mask));
+        } else if (x.isSigned) {
+            physical = static_cast<double>(static_cast<qint64>(raw));
+        } else {
+            physical = static_cast<double>(raw);
+        }
+
+        out[written].signal = signalIndex;
+        out[written].value = static_cast<float>(physical * x.factor + x.offset);
+        ++written;
+    }
+    return written;
+}
+
+int CanSignalDecoder::findRole(const QString &role) const
+{
+    for (int i = 0; i < m_signals.size(); ++i) {
+        if (m_signals[i].role == role) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+QVector<quint32> CanSignalDecoder::messageIds() const
+{
+    QVector<quint32> ids;
+    ids.reserve(m_messages.size());
+    for (const Message &message : m_messages) {
+        ids.append(message.canId);
+    }
+    return ids;
+}
+
+void CanSignalDecoder::loadDefaults()
+{
+    clear();
+
+    // candump 기준: can0 123 [8] 11 80 ... -> 첫 바이트 = km/h, 둘째 바이트 = 1/256 km/h
+    // (1바이트 노드: DLC 1 프레임도 minDlc = 1 로 정수 km/h 디코딩)
+    Signal speed;
+    speed.name = "VehicleSpeed";
+    speed.role = "speed_kmh";
+    speed.canId = 0x123;
+    speed.startBit = 7;
+    speed.length = 16;
+    speed.littleEndian = false;
+    speed.factor = 1.0 / 256.0;
+    speed.minDlc = 1;
+    appendSignal(speed);
+
+    Signal rpm;
+    rpm.name = "WheelRpm";
+    rpm.role = "rpm";
+    rpm.canId = 0x124;
+    rpm.startBit = 0;
+    rpm.length = 32;
+    rpm.floatBits = 32;
+    appendSignal(rpm);
+
+    rebuildTables();
+}
+
+bool CanSignalDecoder::loadFile(const QString &filename)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open CAN signal database:" << filename;
+        return false;
+    }
+    const QByteArray content = file.readAll();
+    file.close();
+
+    const bool isJson = QFileInfo(filename).suffix().compare("json", Qt::CaseInsensitive) == 0;
+    const bool ok = isJson ? loadJson(content) : loadDbc(content);
+    if (ok) {
+        qDebug() << "Loaded" << m_signals.size() << "CAN signal(s) in"
+                 << m_messages.size() << "message(s) from" << filename;
+    }
+    return ok;
+}
+
+bool CanSignalDecoder::loadDbc(const QByteArray &text)
+{
+    static const QRegularExpression messageRe(
+        R"(^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+))");
+    static const QRegularExpression signalRe(
+        R"(^SG_\s+(\w+)\s*(?:[Mm]\d*\s*)?:\s*(\d+)\|(\d+)@([01])([+-])\s*\(\s*([-+0-9.eE]+)\s*,\s*([-+0-9.eE]+)\s*\))");
+    static const QRegularExpression valueTypeRe(
+        R"(^SIG_VALTYPE_\s+(\d+)\s+(\w+)\s*:\s*([12])\s*;)");
+    static const QRegularExpression roleRe(
+        R"(^BA_\s+"DashboardRole"\s+SG_\s+(\d+)\s+(\w+)\s+"([^"]*)"\s*;)");
+    static const QRegularExpression minDlcRe(
+        R"(^BA_\s+"MinDlc"\s+SG_\s+(\d+)\s+(\w+)\s+(\d+)\s*;)");
+
+    QVector<Signal> parsed;
+    quint32 currentId = 0;
+    bool inMessage = false;
+
+    auto findParsed = [&parsed](quint32 id, const QString &name) -> Signal * {
+        for (Signal &s : parsed) {
+            if (s.canId == id && s.name == name) {
+                return &s;
+            }
+        }
+        return nullptr;
+    };
+
+    const QList<QByteArray> lines = text.split('\n');
+    for (const QByteArray &rawLine : lines) {
+        const QString line = QString::fromUtf8(rawLine).trimmed();
+        if (line.isEmpty()) {
+            inMessage = false;
+            continue;
+        }
+
+        QRegularExpressionMatch m = messageRe.match(line);
+        if (m.hasMatch()) {
+            currentId = m.captured(1).toUInt();
+            inMessage = true;
+            continue;
+        }
+
+        m = signalRe.match(line);
+        if (m.hasMatch() && inMessage) {
+            Signal s;
+            s.name = m.captured(1);
+            s.canId = currentId;
+            s.startBit = m.captured(2).toInt();
+            s.length = m.captured(3).toInt();
+            s.littleEndian = (m.captured(4) == "1");
+            s.isSigned = (m.captured(5) == "-");
+            s.factor = m.captured(6).toDouble();
+            s.offset = m.captured(7).toDouble();
+            parsed.append(s);
+            continue;
+        }
+
+        m = valueTypeRe.match(line);
+        if (m.hasMatch()) {
+            if (Signal *s = findParsed(m.captured(1).toUInt(), m.captured(2))) {
+                s->floatBits = (m.captured(3) == "1") ? 32 : 64;
+            }
+            continue;
+        }
+
+        m = roleRe.match(line);
+        if (m.hasMatch()) {
+            if (Signal *s = findParsed(m.captured(1).toUInt(), m.captured(2))) {
+                s->role = m.captured(3);
+            }
+            continue;
+        }
+
+        m = minDlcRe.match(line);
+        if (m.hasMatch()) {
+            if (Signal *s = findParsed(m.captured(1).toUInt(), m.captured(2))) {
+                s->minDlc = m.captured(3).toInt();
+            }
+        }
+    }
+
+    if (parsed.isEmpty()) {
+        qWarning() << "No signals found in DBC file";
+        return false;
+    }
+
+    clear();
+    for (const Signal &s : parsed) {
+        appendSignal(s);
+    }
+    rebuildTables();
+    return !m_signals.isEmpty();
+}
+
+bool CanSignalDecoder::loadJson(const QByteArray &json)
+{
+    const QJsonDocument doc = QJsonDocument::fromJson(json);
+    if (!doc.isObject()) {
+        qWarning() << "Invalid JSON in CAN signal database";
+        return false;
+    }
+
+    clear();
+    const QJsonArray messages = doc.object()["messages"].toArray();
+    for (const QJsonValue &messageValue : messages) {
+        const QJsonObject message = messageValue.toObject();
+        quint32 id = parseId(message["id"]);
+        if (message["extended"].toBool(false)) {
+            id |= EFF_FLAG;
+        }
+
+        const QJsonArray signalList = message["signals"].toArray();
+        for (const QJsonValue &signalValue : signalList) {
+            const QJsonObject obj = signalValue.toObject();
+            Signal s;
+            s.name = obj["name"].toString();
+            s.role = obj["role"].toString();
+            s.canId = id;
+            s.startBit = obj["start_bit"].toInt(0);
+            s.length = obj["length"].toInt(8);
+            s.littleEndian = obj["byte_order"].toString("little_endian") != "big_endian";
+            s.isSigned = obj["signed"].toBool(false);
+            const QString type = obj["type"].toString("int");
+            s.floatBits = (type == "float") ? 32 : (type == "double") ? 64 : 0;
+            s.factor = obj["factor"].toDouble(1.0);
+            s.offset = obj["offset"].toDouble(0.0);
+            s.minDlc = obj["min_dlc"].toInt(0);
+            appendSignal(s);
+        }
+    }
+    rebuildTables();
+
+    if (m_signals.isEmpty()) {
+        qWarning() << "No signals found in CAN signal database";
+        return false;
+    }
+    return true;
+}
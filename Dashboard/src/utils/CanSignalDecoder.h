@@ -0,0 +1,118 @@
+/**
+ * @file CanSignalDecoder.h
+ * @brief Table-driven CAN Signal Decoder (DBC / JSON signal database)
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef CANSIGNALDECODER_H
+#define CANSIGNALDECODER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+/**
+ * @class CanSignalDecoder
+ * @brief Decodes CAN payloads into physical values with precompiled extractors
+ *
+ * Features:
+ * - Loads a DBC file or an equivalent JSON signal database at startup
+ * - Per-ID lookup table (dense for 11-bit IDs, hashed for 29-bit IDs)
+ * - Intel/Motorola byte order, signed, IEEE float/double signals
+ * - Decodes every signal of a frame in one pass, no allocation
+ *
+ * Signals carry an optional dashboard role ("speed_kmh", "rpm") so the
+ * reader can route values without hard-coded CAN IDs. In DBC files the
+ * role is set with the string attribute "DashboardRole" on the signal.
+ *
+ * IDs follow the Linux can_id / DBC convention: bit 31 marks a 29-bit ID.
+ *
+ * A frame shorter than a signal skips that signal. A signal can opt in to
+ * shorter frames with minDlc (DBC attribute "MinDlc", JSON "min_dlc"): frames
+ * of at least minDlc bytes decode with the missing bytes read as zero. The
+ * PiRacer 0x123 speed uses it so 1-byte integer km/h nodes keep working.
+ */
+class CanSignalDecoder
+{
+public:
+    struct Signal {
+        QString name;
+        QString role;
+        quint32 canId = 0;
+        int startBit = 0;          // DBC start bit (LSB for Intel, MSB for Motorola)
+        int length = 0;
+        bool littleEndian = true;  // DBC @1 = Intel, @0 = Motorola
+        bool isSigned = false;
+        int floatBits = 0;         // 0 = integer, 32 = IEEE float, 64 = IEEE double
+        double factor = 1.0;
+        double offset = 0.0;
+        int minDlc = 0;            // 0 = whole signal required, else shortest frame decoded
+    };
+
+    struct Value {
+        int signal;    // Index into signal()
+        float value;   // Physical value (raw * factor + offset)
+    };
+
+    static constexpr quint32 EFF_FLAG = 0x80000000U;
+    static constexpr int MAX_VALUES_PER_FRAME = 32;
+
+    CanSignalDecoder();
+
+    // Format picked by extension: .dbc or .json
+    bool loadFile(const QString &filename);
+    bool loadDbc(const QByteArray &text);
+    bool loadJson(const QByteArray &json);
+
+    // Built-in PiRacer layout: 0x123 bytes 0-1 = km/h * 256 big-endian (byte 0 =
+    // integer km/h), 0x124 float32 LE = wheel RPM
+    void loadDefaults();
+
+    bool addSignal(const Signal &signal);
+    void clear();
+
+    // Returns number of values written to out (at most maxValues).
+    int decode(quint32 canId, const quint8 *data, int dlc, Value *out, int maxValues) const;
+
+    int signalCount() const { return m_signals.size(); }
+    const Signal &signal(int index) const { return m_signals[index]; }
+    int findRole(const QString &role) const;
+    QVector<quint32> messageIds() const;
+
+private:
+    struct Extractor {
+        quint64 mask;
+        quint8 shift;
+        quint8 bytesNeeded;   // Minimum DLC to decode the signal
+        bool bigEndian;
+        bool isSigned;
+        quint8 floatBits;
+        quint8 length;
+        double factor;
+        double offset;
+    };
+
+    struct Message {
+        quint32 canId;
+        int first;   // Into m_order
+        int count;
+    };
+
+    static constexpr int SFF_TABLE_SIZE = 0x800;
+
+    static quint32 normalizeId(quint32 canId);
+    bool appendSignal(const Signal &signal);
+    void rebuildTables();
+    int lookupMessage(quint32 key) const;
+
+    QVector<Signal> m_signals;
+    QVector<Extractor> m_extractors;   // Parallel to m_signals
+    QVector<int> m_order;              // Signal indices grouped by message
+    QVector<Message> m_messages;
+    QVector<qint16> m_sffTable;        // 11-bit ID -> message index, -1 if unused
+    QHash<quint32, int> m_effTable;    // 29-bit ID (with EFF_FLAG) -> message index
+};
+
+#endif // CANSIGNALDECODER_H
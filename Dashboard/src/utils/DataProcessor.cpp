@@ -7,9 +7,6 @@
 
 #include "DataProcessor.h"
 #include "CalibrationManager.h"
-#include <QCoreApplication>
-#include <QDir>
-#include <QFileInfo>
 #include <QDebug>
 
 DataProcessor::DataProcessor(QObject *parent)
@@ -17,35 +14,17 @@ DataProcessor::DataProcessor(QObject *parent)
     , m_speedCalibrationFactor(0.72f)  // Default value (needs calibration)
     , m_pulsesPerRevolution(20)        // Default value (needs calibration)
 {
-    // Try to load calibration from common runtime locations
-    CalibrationManager calibration;
-    const QString appDir = QCoreApplication::applicationDirPath();
-    const QStringList candidateConfigs = {
-        "config/calibration.json",
-        QDir::cleanPath(appDir + "/config/calibration.json"),
-        QDir::cleanPath(appDir + "/../config/calibration.json"),
-        QDir::cleanPath(appDir + "/../../config/calibration.json")
-    };
-
-    QString calibrationPath;
-    for (const QString &candidate : candidateConfigs) {
-        if (QFileInfo::exists(candidate)) {
-            calibrationPath = candidate;
-            break;
-        }
-    }
+}
 
-    if (!calibrationPath.isEmpty() && calibration.load(calibrationPath)) {
-        m_speedCalibrationFactor = calibration.speedCalibration();
-        m_pulsesPerRevolution = calibration.pulsesPerRevolution();
-        
-        qDebug() << "Loaded calibration:";
-        qDebug() << "  File:" << calibrationPath;
-        qDebug() << "  Speed factor:" << m_speedCalibrationFactor;
-        qDebug() << "  Pulses/rev:" << m_pulsesPerRevolution;
-    } else {
-        qWarning() << "Using default calibration values";
-    }
+void DataProcessor::applyCalibration(const CalibrationManager &calibration)
+{
+    // The caller loads the config file once and shares it across components.
+    m_speedCalibrationFactor = calibration.speedCalibration();
+    m_pulsesPerRevolution = calibration.pulsesPerRevolution();
+    
+    qDebug() << "Applied calibration:";
+    qDebug() << "  Speed factor:" << m_speedCalibrationFactor;
+    qDebug() << "  Pulses/rev:" << m_pulsesPerRevolution;
 }
 
 float DataProcessor::pulseToKmh(float pulsePerSec) const
@@ -10,6 +10,8 @@
 
 #include <QObject>
 
+class CalibrationManager;
+
 /**
  * @class DataProcessor
  * @brief Converts raw sensor data to display units
@@ -31,6 +33,7 @@ public:
     float pulseToRPM(float pulsePerSec) const;
     
     // Calibration
+    void applyCalibration(const CalibrationManager &calibration);
     void setSpeedCalibration(float factor);
     void setPulsesPerRevolution(int pulses);
     
@@ -0,0 +1,119 @@
+/**
+ * @file DriveModeSource.cpp
+ * @brief Drive Mode Source Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "DriveModeSource.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+#include <QDebug>
+
+DriveModeSource::DriveModeSource(const QString &path, QObject *parent)
+    : QObject(parent)
+    , m_path(path)
+    , m_watcher(nullptr)
+    , m_staleTimer(nullptr)
+    , m_direction("N")
+    , m_fresh(false)
+{
+    m_watcher = new QFileSystemWatcher(this);
+    // The writer may create or rename the file, so watch its directory too.
+    m_watcher->addPath(QFileInfo(m_path).absolutePath());
+    connect(m_watcher, &QFileSystemWatcher::fileChanged,
+            this, &DriveModeSource::onPathChanged);
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged,
+            this, &DriveModeSource::onPathChanged);
+
+    m_staleTimer = new QTimer(this);
+    connect(m_staleTimer, &QTimer::timeout, this, &DriveModeSource::checkStaleness);
+    m_staleTimer->start(STALE_CHECK_INTERVAL_MS);
+
+    watchFile();
+    reload();
+}
+
+void DriveModeSource::watchFile()
+{
+    // QFileSystemWatcher drops a file once it is removed or replaced.
+    if (!m_watcher->files().contains(m_path) && QFileInfo::exists(m_path)) {
+        m_watcher->addPath(m_path);
+    }
+}
+
+void DriveModeSource::onPathChanged()
+{
+    watchFile();
+
+    // Directory events fire for unrelated files in /tmp; skip unless ours moved.
+    const QFileInfo info(m_path);
+    if (!info.exists() || info.lastModified() == m_lastModified) {
+        return;
+    }
+    reload();
+}
+
+void DriveModeSource::reload()
+{
+    const QFileInfo info(m_path);
+    if (!info.exists()) {
+        setFresh(false);
+        return;
+    }
+
+    m_lastModified = info.lastModified();
+    // Use snapshot only when it is fresh enough.
+    if (m_lastModified.msecsTo(QDateTime::currentDateTime()) > STALE_AFTER_MS) {
+        setFresh(false);
+        return;
+    }
+
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return;
+    }
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    file.close();
+    if (!doc.isObject()) {
+        return;
+    }
+
+    const QString raw = doc.object().value("direction").toString().trimmed().toUpper();
+    QString direction;
+    if (raw.startsWith("R")) {
+        direction = "R";
+    } else if (raw.startsWith("F")) {
+        direction = "F";
+    } else if (raw.startsWith("N")) {
+        direction = "N";
+    } else {
+        return;
+    }
+
+    setFresh(true);
+    if (direction != m_direction) {
+        m_direction = direction;
+        emit directionChanged(m_direction);
+    }
+}
+
+void DriveModeSource::checkStaleness()
+{
+    if (m_fresh && m_lastModified.msecsTo(QDateTime::currentDateTime()) > STALE_AFTER_MS) {
+        setFresh(false);
+    }
+}
+
+void DriveModeSource::setFresh(bool fresh)
+{
+    if (fresh == m_fresh) {
+        return;
+    }
+    m_fresh = fresh;
+    emit freshnessChanged(m_fresh);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file DriveModeSource.h
+ * @brief Event-driven Drive Mode Snapshot Reader
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef DRIVEMODESOURCE_H
+#define DRIVEMODESOURCE_H
+
+#include <QObject>
+#include <QDateTime>
+#include <QString>
+
+class QFileSystemWatcher;
+class QTimer;
+
+/**
+ * @class DriveModeSource
+ * @brief Watches /tmp/piracer_drive_mode.json and caches the parsed direction
+ *
+ * Features:
+ * - inotify-backed QFileSystemWatcher, file is parsed only when it changes
+ * - Survives atomic replace (rename) by also watching the directory
+ * - Staleness (> 2 s since last write) checked by a timer, not per sample
+ * - Emits directionChanged() only on a real F/R/N transition
+ */
+class DriveModeSource : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DriveModeSource(const QString &path = QStringLiteral("/tmp/piracer_drive_mode.json"),
+                             QObject *parent = nullptr);
+
+    QString direction() const { return m_direction; }
+    bool isFresh() const { return m_fresh; }
+
+signals:
+    void directionChanged(const QString &direction);
+    void freshnessChanged(bool fresh);
+
+private slots:
+    void onPathChanged();
+    void checkStaleness();
+
+private:
+    void watchFile();
+    void reload();
+    void setFresh(bool fresh);
+
+    static constexpr int STALE_AFTER_MS = 2000;
+    static constexpr int STALE_CHECK_INTERVAL_MS = 500;
+
+    QString m_path;
+    QFileSystemWatcher *m_watcher;
+    QTimer *m_staleTimer;
+    QDateTime m_lastModified;
+    QString m_direction;
+    bool m_fresh;
+};
+
+#endif // DRIVEMODESOURCE_H
@@ -0,0 +1,64 @@
+/**
+ * @file FrameScheduler.cpp
+ * @brief Frame Scheduler Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "FrameScheduler.h"
+#include <QTimer>
+#include <QDebug>
+
+FrameScheduler::FrameScheduler(int targetFps, QObject *parent)
+    : QObject(parent)
+    , m_timer(nullptr)
+    , m_lastTickNs(0)
+    , m_targetFps(0)
+    , m_frameCount(0)
+{
+    m_timer = new QTimer(this);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &FrameScheduler::onTick);
+    setTargetFps(targetFps);
+}
+
+void FrameScheduler::start()
+{
+    m_clock.start();
+    m_lastTickNs = 0;
+    m_timer->start();
+    qDebug() << "Frame scheduler running at" << m_targetFps << "FPS";
+}
+
+void FrameScheduler::stop()
+{
+    m_timer->stop();
+}
+
+bool FrameScheduler::isActive() const
+{
+    return m_timer->isActive();
+}
+
+void FrameScheduler::setTargetFps(int fps)
+{
+    m_targetFps = qBound(MIN_FPS, fps, MAX_FPS);
+    // QTimer resolution is 1 ms; round down so the target rate is a floor (60 -> 16 ms).
+    m_timer->setInterval(1000 / m_targetFps);
+}
+
+void FrameScheduler::onTick()
+{
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    if (m_lastTickNs > 0) {
+        m_intervals.record(nowNs - m_lastTickNs);
+    }
+    float dt = (nowNs - m_lastTickNs) / 1e9f;
+    m_lastTickNs = nowNs;
+    if (dt > MAX_FRAME_DT) {
+        dt = MAX_FRAME_DT;
+    }
+
+    ++m_frameCount;
+    emit frame(dt);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file FrameScheduler.h
+ * @brief Display Frame Clock for the Cluster
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+
+#include "LatencyHistogram.h"
+
+class QTimer;
+
+/**
+ * @class FrameScheduler
+ * @brief Emits one frame() tick per display frame at a fixed target FPS
+ *
+ * Features:
+ * - Single PreciseTimer clock shared by every cluster widget
+ * - Measured frame delta passed to consumers (clamped after stalls)
+ * - Frame counter for FPS reporting
+ * - Histogram of tick-to-tick intervals (GUI thread stalls show up here)
+ *
+ * Sensor handlers only store the latest value; the frame handler applies
+ * it, advances needle motion and triggers one coalesced repaint, so the
+ * repaint rate follows the display instead of the CAN rate.
+ */
+class FrameScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FrameScheduler(int targetFps = 60, QObject *parent = nullptr);
+
+    void start();
+    void stop();
+    bool isActive() const;
+
+    void setTargetFps(int fps);
+    int targetFps() const { return m_targetFps; }
+    quint64 frameCount() const { return m_frameCount; }
+    const LatencyHistogram &frameIntervals() const { return m_intervals; }
+
+signals:
+    // dtSeconds: time since the previous frame
+    void frame(float dtSeconds);
+
+private slots:
+    void onTick();
+
+private:
+    static constexpr int MIN_FPS = 10;
+    static constexpr int MAX_FPS = 120;
+    static constexpr float MAX_FRAME_DT = 0.1f;  // Avoid needle jumps after a stall
+
+    QTimer *m_timer;
+    QElapsedTimer m_clock;
+    qint64 m_lastTickNs;
+    int m_targetFps;
+    quint64 m_frameCount;
+    LatencyHistogram m_intervals;
+};
+
+#endif // FRAMESCHEDULER_H
@@ -0,0 +1,89 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Latency Histogram Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::reset()
+{
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_maxUs.store(0, std::memory_order_relaxed);
+}
+
+int LatencyHistogram::bucketIndex(quint32 us)
+{
+    if (us < static_cast<quint32>(SUB_BUCKETS)) {
+        return static_cast<int>(us);
+    }
+    if (us >= (1U << MAX_EXPONENT)) {
+        return BUCKET_COUNT - 1;
+    }
+
+    // exponent = floor(log2(us)); the next SUB_BUCKET_BITS bits pick the sub-bucket.
+    const int exponent = 31 - __builtin_clz(us);
+    const int shift = exponent - SUB_BUCKET_BITS;
+    const int sub = static_cast<int>((us >> shift) & (SUB_BUCKETS - 1));
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+quint32 LatencyHistogram::bucketUpperUs(int index)
+{
+    if (index < SUB_BUCKETS) {
+        return static_cast<quint32>(index);
+    }
+    const int exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    const int shift = exponent - SUB_BUCKET_BITS;
+    const quint32 lower = static_cast<quint32>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lower + (1U << shift) - 1;
+}
+
+void LatencyHistogram::record(qint64 durationNs)
+{
+    // Clock steps (CLOCK_REALTIME) can make a stage negative; count it as 0.
+    const qint64 us64 = qBound<qint64>(0, durationNs / 1000, 0xFFFFFFFFLL);
+    const quint32 us = static_cast<quint32>(us64);
+
+    m_buckets[bucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    quint32 previousMax = m_maxUs.load(std::memory_order_relaxed);
+    while (us > previousMax &&
+           !m_maxUs.compare_exchange_weak(previousMax, us, std::memory_order_relaxed)) {
+    }
+}
+
+qint64 LatencyHistogram::percentileUs(double fraction) const
+{
+    // Snapshot first so the rank and the walk agree while writers keep going.
+    quint32 snapshot[BUCKET_COUNT];
+    quint64 total = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        snapshot[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += snapshot[i];
+    }
+    if (total == 0) {
+        return -1;
+    }
+
+    const double clamped = qBound(0.0, fraction, 1.0);
+    const quint64 rank = qMax<quint64>(1, static_cast<quint64>(clamped * total + 0.999999));
+    quint64 seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += snapshot[i];
+        if (seen >= rank) {
+            return qMin<qint64>(bucketUpperUs(i), maxUs());
+        }
+    }
+    return maxUs();
+}
@@ -0,0 +1,55 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Lock-free Log-linear Latency Histogram
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QtGlobal>
+#include <atomic>
+
+/**
+ * @class LatencyHistogram
+ * @brief Fixed-size latency histogram with microsecond resolution
+ *
+ * Features:
+ * - Log-linear buckets: exact below 8 µs, then 8 sub-buckets per power of
+ *   two (<= 12.5 % bucket width) up to ~16 s
+ * - record() is a relaxed atomic increment: any thread may record while
+ *   another reads percentiles, no locks, no allocation
+ * - Percentiles report the bucket upper bound, so they never under-state
+ *
+ * Counters are 32-bit so the increments stay lock-free on ARMv7.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int MAX_EXPONENT = 24;  // 2^24 µs ~= 16.8 s
+    static constexpr int BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    LatencyHistogram();
+
+    void record(qint64 durationNs);
+    void reset();
+
+    quint32 count() const { return m_count.load(std::memory_order_relaxed); }
+    quint32 maxUs() const { return m_maxUs.load(std::memory_order_relaxed); }
+
+    // fraction in [0, 1]; returns -1 when the histogram is empty
+    qint64 percentileUs(double fraction) const;
+
+    static int bucketIndex(quint32 us);
+    static quint32 bucketUpperUs(int index);
+
+private:
+    std::atomic<quint32> m_buckets[BUCKET_COUNT];
+    std::atomic<quint32> m_count;
+    std::atomic<quint32> m_maxUs;
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,143 @@
+/**
+ * @file LatencyTracer.cpp
+ * @brief Latency Tracer Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "LatencyTracer.h"
+#include <QDateTime>
+#include <QFile>
+#include <QDebug>
+
+#include <ctime>
+
+LatencyTracer &LatencyTracer::instance()
+{
+    static LatencyTracer tracer;
+    return tracer;
+}
+
+LatencyTracer::LatencyTracer()
+    : m_nextId(1)
+{
+    for (int i = 0; i < TRACE_SLOTS; ++i) {
+        m_traces[i] = Trace{0, 0, 0, 0};
+    }
+}
+
+qint64 LatencyTracer::nowNs()
+{
+    struct timespec now;
+    ::clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+quint32 LatencyTracer::begin(qint64 rxTimestampNs)
+{
+    const quint32 id = m_nextId++;
+    if (m_nextId == 0) {
+        m_nextId = 1;
+    }
+
+    // Reusing a slot silently abandons the trace that was there.
+    Trace &trace = m_traces[id & (TRACE_SLOTS - 1)];
+    trace.id = id;
+    trace.rxNs = rxTimestampNs;
+    trace.dequeueNs = nowNs();
+    trace.updateNs = 0;
+    return id;
+}
+
+LatencyTracer::Trace *LatencyTracer::find(quint32 traceId)
+{
+    if (traceId == 0) {
+        return nullptr;
+    }
+    Trace &trace = m_traces[traceId & (TRACE_SLOTS - 1)];
+    return (trace.id == traceId) ? &trace : nullptr;
+}
+
+void LatencyTracer::markUpdated(quint32 traceId)
+{
+    Trace *trace = find(traceId);
+    if (trace && trace->updateNs == 0) {
+        trace->updateNs = nowNs();
+    }
+}
+
+void LatencyTracer::markPainted(quint32 traceId)
+{
+    Trace *trace = find(traceId);
+    if (!trace || trace->updateNs == 0) {
+        return;
+    }
+
+    const qint64 paintedNs = nowNs();
+    m_histograms[KernelToDequeue].record(trace->dequeueNs - trace->rxNs);
+    m_histograms[DequeueToUpdate].record(trace->updateNs - trace->dequeueNs);
+    m_histograms[UpdateToPaint].record(paintedNs - trace->updateNs);
+    m_histograms[EndToEnd].record(paintedNs - trace->rxNs);
+    trace->id = 0;  // First paint only
+}
+
+void LatencyTracer::reset()
+{
+    for (int i = 0; i < StageCount; ++i) {
+        m_histograms[i].reset();
+    }
+}
+
+const char *LatencyTracer::stageName(Stage stage)
+{
+    switch (stage) {
+    case KernelToDequeue: return "rx->dequeue";
+    case DequeueToUpdate: return "dequeue->update";
+    case UpdateToPaint:   return "update->paint";
+    case EndToEnd:        return "rx->paint";
+    case StageCount:      break;
+    }
+    return "?";
+}
+
+QString LatencyTracer::report() const
+{
+    auto ms = [](qint64 us) {
+        return (us < 0) ? QStringLiteral("-").rightJustified(7)
+                        : QString::number(us / 1000.0, 'f', 2).rightJustified(7);
+    };
+
+    QString text = QStringLiteral("%1%2%3%4%5  (ms, n=%6)\n")
+                       .arg(QStringLiteral("stage").leftJustified(16))
+                       .arg(QStringLiteral("p50").rightJustified(7))
+                       .arg(QStringLiteral("p95").rightJustified(7))
+                       .arg(QStringLiteral("p99").rightJustified(7))
+                       .arg(QStringLiteral("max").rightJustified(7))
+                       .arg(m_histograms[EndToEnd].count());
+    for (int i = 0; i < StageCount; ++i) {
+        const LatencyHistogram &histogram = m_histograms[i];
+        text += QString::fromLatin1(stageName(static_cast<Stage>(i))).leftJustified(16)
+              + ms(histogram.percentileUs(0.50))
+              + ms(histogram.percentileUs(0.95))
+              + ms(histogram.percentileUs(0.99))
+              + ms(histogram.count() > 0 ? qint64(histogram.maxUs()) : -1)
+              + QLatin1Char('\n');
+    }
+    return text;
+}
+
+bool LatencyTracer::dumpToFile(const QString &path) const
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qWarning() << "Failed to write latency dump:" << path;
+        return false;
+    }
+    file.write(QDateTime::currentDateTime().toString(Qt::ISODateWithMs).toUtf8());
+    file.write("\n");
+    file.write(report().toUtf8());
+    file.close();
+
+    qDebug() << "Latency histogram written to" << path;
+    return true;
+}
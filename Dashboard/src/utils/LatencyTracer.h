@@ -0,0 +1,82 @@
+/**
+ * @file LatencyTracer.h
+ * @brief CAN Frame to Painted Pixel Latency Tracing
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef LATENCYTRACER_H
+#define LATENCYTRACER_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include "LatencyHistogram.h"
+
+/**
+ * @class LatencyTracer
+ * @brief Follows speed samples from kernel receive to the paint that shows them
+ *
+ * A trace is opened when SerialReader hands a sample to the GUI thread and
+ * its ID travels with the value:
+ *
+ *   SO_TIMESTAMPNS rx --> dequeue (begin) --> widget state (markUpdated)
+ *                     --> paint complete (markPainted)
+ *
+ * Samples coalesced away before reaching a widget, or that do not change
+ * the displayed value, never complete and are not counted. "Paint complete"
+ * is the end of the widget's paintEvent; compositor/scan-out time is not
+ * visible from here.
+ *
+ * All stamps use CLOCK_REALTIME, the clock of the kernel receive timestamp.
+ * begin()/mark*() are GUI-thread only; the histograms can be read anywhere.
+ */
+class LatencyTracer
+{
+public:
+    enum Stage {
+        KernelToDequeue,   // Frame in socket buffer / ingest ring
+        DequeueToUpdate,   // Waiting for the next frame tick
+        UpdateToPaint,     // Widget state set -> paintEvent done
+        EndToEnd,          // Kernel receive -> paintEvent done
+        StageCount
+    };
+
+    static LatencyTracer &instance();
+
+    static qint64 nowNs();
+
+    // Opens a trace for a sample received at rxTimestampNs; returns its ID (never 0).
+    quint32 begin(qint64 rxTimestampNs);
+    void markUpdated(quint32 traceId);
+    void markPainted(quint32 traceId);
+
+    const LatencyHistogram &histogram(Stage stage) const { return m_histograms[stage]; }
+    void reset();
+
+    // p50/p95/p99/max table in milliseconds, one line per stage
+    QString report() const;
+    bool dumpToFile(const QString &path) const;
+
+    static const char *stageName(Stage stage);
+
+private:
+    struct Trace {
+        quint32 id;
+        qint64 rxNs;
+        qint64 dequeueNs;
+        qint64 updateNs;
+    };
+
+    static constexpr int TRACE_SLOTS = 64;  // Power of two; open traces in flight
+
+    LatencyTracer();
+
+    Trace *find(quint32 traceId);
+
+    Trace m_traces[TRACE_SLOTS];
+    quint32 m_nextId;
+    LatencyHistogram m_histograms[StageCount];
+};
+
+#endif // LATENCYTRACER_H
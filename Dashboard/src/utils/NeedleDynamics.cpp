@@ -0,0 +1,57 @@
+/**
+ * @file NeedleDynamics.cpp
+ * @brief Needle Dynamics Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "NeedleDynamics.h"
+#include <QtGlobal>
+#include <cmath>
+
+NeedleDynamics::NeedleDynamics(float responseTimeSec, float initialValue)
+    : m_responseTime(0.0f)
+    , m_omega(0.0f)
+    , m_value(initialValue)
+    , m_velocity(0.0f)
+    , m_target(initialValue)
+    , m_settled(true)
+{
+    setResponseTime(responseTimeSec);
+}
+
+void NeedleDynamics::setResponseTime(float seconds)
+{
+    m_responseTime = qMax(0.01f, seconds);
+    m_omega = RESPONSE_TO_OMEGA / m_responseTime;
+}
+
+void NeedleDynamics::reset(float value)
+{
+    m_value = value;
+    m_target = value;
+    m_velocity = 0.0f;
+    m_settled = true;
+}
+
+bool NeedleDynamics::advance(float dtSeconds)
+{
+    const float delta = m_value - m_target;
+    if (qAbs(delta) < SETTLE_EPSILON && qAbs(m_velocity) < SETTLE_EPSILON) {
+        if (!m_settled) {
+            m_value = m_target;
+            m_velocity = 0.0f;
+            m_settled = true;
+            return true;   // Final snap still needs a repaint
+        }
+        return false;
+    }
+    m_settled = false;
+
+    // x(t) = target + (d0 + (v0 + w*d0) * t) * e^(-w*t)
+    const float decay = std::exp(-m_omega * dtSeconds);
+    const float drive = (m_velocity + m_omega * delta) * dtSeconds;
+    m_velocity = (m_velocity - m_omega * drive) * decay;
+    m_value = m_target + (delta + drive) * decay;
+    return true;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file NeedleDynamics.h
+ * @brief Critically-damped Needle Motion Shared by the Gauges
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef NEEDLEDYNAMICS_H
+#define NEEDLEDYNAMICS_H
+
+/**
+ * @class NeedleDynamics
+ * @brief Critically-damped spring that follows a moving target
+ *
+ * Features:
+ * - Exact closed-form step, stable for any frame delta
+ * - Retargeting keeps position and velocity (no restart, no allocation)
+ * - Response time = time to cover ~95% of a step change
+ * - lag() exposes displayed-vs-actual error for tuning
+ *
+ * Units are whatever the caller uses (the gauges feed needle angles).
+ */
+class NeedleDynamics
+{
+public:
+    explicit NeedleDynamics(float responseTimeSec = 0.22f, float initialValue = 0.0f);
+
+    void setResponseTime(float seconds);
+    float responseTime() const { return m_responseTime; }
+
+    void setTarget(float target) { m_target = target; }
+    void reset(float value);   // Jump to value and stop
+
+    // Integrates dtSeconds; returns true while the value is still moving.
+    bool advance(float dtSeconds);
+
+    float value() const { return m_value; }
+    float target() const { return m_target; }
+    float velocity() const { return m_velocity; }
+    float lag() const { return m_target - m_value; }
+    bool isSettled() const { return m_settled; }
+
+private:
+    // (1 + x) * exp(-x) = 0.05 at x ~= 4.74
+    static constexpr float RESPONSE_TO_OMEGA = 4.74f;
+    static constexpr float SETTLE_EPSILON = 0.01f;
+
+    float m_responseTime;
+    float m_omega;
+    float m_value;
+    float m_velocity;
+    float m_target;
+    bool m_settled;
+};
+
+#endif // NEEDLEDYNAMICS_H
@@ -0,0 +1,206 @@
+/**
+ * @file SocEstimator.cpp
+ * @brief SOC Estimator Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "SocEstimator.h"
+#include <cmath>
+
+namespace {
+
+// Single-cell LiPo OCV curve (no-load approximation), same points as the bridge.
+struct OcvPoint {
+    qint32 cellMv;
+    qint32 centiPct;
+};
+
+constexpr OcvPoint OCV_CURVE[] = {
+    {4200, 10000},
+    {4120, 9000},
+    {4040, 8000},
+    {3980, 7000},
+    {3920, 6000},
+    {3860, 5000},
+    {3800, 4000},
+    {3740, 3000},
+    {3680, 2000},
+    {3550, 1000},
+    {3300, 0},
+};
+
+constexpr qint32 LUT_MIN_MV = 3300;
+constexpr qint32 LUT_MAX_MV = 4200;
+constexpr int LUT_SIZE = LUT_MAX_MV - LUT_MIN_MV + 1;
+
+// Dense 1 mV table, built once from the curve above.
+struct OcvTable {
+    qint16 centiPct[LUT_SIZE];
+
+    OcvTable()
+    {
+        const int points = sizeof(OCV_CURVE) / sizeof(OCV_CURVE[0]);
+        for (int i = 0; i < LUT_SIZE; ++i) {
+            const qint32 mv = LUT_MIN_MV + i;
+            qint32 value = 0;
+            for (int p = 0; p + 1 < points; ++p) {
+                const OcvPoint &high = OCV_CURVE[p];
+                const OcvPoint &low = OCV_CURVE[p + 1];
+                if (mv >= low.cellMv && mv <= high.cellMv) {
+                    value = low.centiPct + (mv - low.cellMv) * (high.centiPct - low.centiPct)
+                                               / (high.cellMv - low.cellMv);
+                    break;
+                }
+            }
+            centiPct[i] = static_cast<qint16>(value);
+        }
+    }
+};
+
+const OcvTable &ocvTable()
+{
+    static const OcvTable table;
+    return table;
+}
+
+} // namespace
+
+qint32 SocEstimator::MedianWindow::push(qint32 value)
+{
+    if (m_count == MEDIAN_WINDOW) {
+        // Evict the oldest sample from the sorted view.
+        const qint32 evicted = m_arrival[m_oldest];
+        int pos = 0;
+        while (m_sorted[pos] != evicted) {
+            ++pos;
+        }
+        for (; pos + 1 < m_count; ++pos) {
+            m_sorted[pos] = m_sorted[pos + 1];
+        }
+        --m_count;
+        m_arrival[m_oldest] = value;
+        m_oldest = (m_oldest + 1) % MEDIAN_WINDOW;
+    } else {
+        m_arrival[m_count] = value;
+    }
+
+    int pos = m_count;
+    while (pos > 0 && m_sorted[pos - 1] > value) {
+        m_sorted[pos] = m_sorted[pos - 1];
+        --pos;
+    }
+    m_sorted[pos] = value;
+    ++m_count;
+
+    // Same as statistics.median for odd counts; even counts average the middle pair.
+    if (m_count % 2 == 1) {
+        return m_sorted[m_count / 2];
+    }
+    return (m_sorted[m_count / 2 - 1] + m_sorted[m_count / 2]) / 2;
+}
+
+SocEstimator::SocEstimator(float capacityMah, float alpha)
+    // 100 % of capacity = capacityMah * 10 (0.1 mA) * 3.6e9 us, spread over 1e8 micro-percent
+    : m_chargePerMicroPct(static_cast<qint64>(qMax(100.0f, capacityMah)) * 360)
+    , m_alphaQ16(static_cast<qint64>(qBound(0.01f, alpha, 1.0f) * 65536.0f))
+    , m_initialized(false)
+    , m_lastTimestampNs(0)
+    , m_stableUv(0)
+    , m_socMicroPct(FULL_MICRO_PCT)
+    , m_chargeResidual(0)
+    , m_chargeUsedDeciMaUs(0)
+{
+    ocvTable();
+}
+
+void SocEstimator::reset()
+{
+    m_median.clear();
+    m_initialized = false;
+    m_lastTimestampNs = 0;
+    m_stableUv = 0;
+    m_socMicroPct = FULL_MICRO_PCT;
+    m_chargeResidual = 0;
+    m_chargeUsedDeciMaUs = 0;
+}
+
+int SocEstimator::detectCellCount(qint32 packUv)
+{
+    // Field packs are 2S or 3S
+    if (packUv >= 10000000) {
+        return 3;
+    }
+    if (packUv >= 6000000) {
+        return 2;
+    }
+    return 1;
+}
+
+qint32 SocEstimator::ocvMicroPercent(qint32 packUv)
+{
+    const qint32 cellUv = packUv / detectCellCount(packUv);
+    if (cellUv >= LUT_MAX_MV * 1000) {
+        return FULL_MICRO_PCT;
+    }
+    if (cellUv < LUT_MIN_MV * 1000) {
+        return 0;
+    }
+
+    // Interpolate between neighbouring 1 mV entries with the uV remainder.
+    const OcvTable &table = ocvTable();
+    const qint32 offsetUv = cellUv - LUT_MIN_MV * 1000;
+    const int index = offsetUv / 1000;
+    const qint32 fraction = offsetUv % 1000;
+    const qint32 low = table.centiPct[index];
+    const qint32 high = table.centiPct[qMin(index + 1, LUT_SIZE - 1)];
+    return low * 10000 + (high - low) * 10 * fraction;
+}
+
+float SocEstimator::ocvPercent(float voltage)
+{
+    return ocvMicroPercent(static_cast<qint32>(std::lround(voltage * 1e6f))) / 1e6f;
+}
+
+float SocEstimator::chargeUsedMah() const
+{
+    // 0.1 mA * us -> mAh
+    return static_cast<float>(m_chargeUsedDeciMaUs / 36000000000.0);
+}
+
+float SocEstimator::update(float voltage, float currentMa, qint64 timestampNs)
+{
+    m_stableUv = m_median.push(static_cast<qint32>(std::lround(voltage * 1e6f)));
+    const qint64 target = ocvMicroPercent(m_stableUv);
+
+    if (!m_initialized) {
+        m_socMicroPct = target;
+        m_lastTimestampNs = timestampNs;
+        m_initialized = true;
+        return socPercent();
+    }
+
+    const qint64 dtUs = qBound<qint64>(0, (timestampNs - m_lastTimestampNs) / 1000, MAX_DT_US);
+    m_lastTimestampNs = timestampNs;
+    const qint64 previous = m_socMicroPct;
+
+    // Coulomb counting; the residual keeps sub-step charge from being lost at 100 Hz.
+    const qint64 charge = static_cast<qint64>(std::lround(currentMa * 10.0f)) * dtUs;
+    m_chargeUsedDeciMaUs += charge;
+    m_chargeResidual += charge;
+    const qint64 steps = m_chargeResidual / m_chargePerMicroPct;
+    m_chargeResidual -= steps * m_chargePerMicroPct;
+    qint64 soc = previous - steps;
+
+    // EMA toward the OCV estimate, alpha scaled to the elapsed time.
+    const qint64 alphaQ16 = qMin(m_alphaQ16, m_alphaQ16 * dtUs / ALPHA_INTERVAL_US);
+    soc += ((target - soc) * alphaQ16) >> 16;
+
+    // Limit sudden jumps so the value changes smoothly.
+    const qint64 maxUp = SLEW_UP_MICRO_PCT_PER_S * dtUs / 1000000;
+    const qint64 maxDown = SLEW_DOWN_MICRO_PCT_PER_S * dtUs / 1000000;
+    soc = qBound(previous - maxDown, soc, previous + maxUp);
+
+    m_socMicroPct = qBound<qint64>(0, soc, FULL_MICRO_PCT);
+    return socPercent();
+}
@@ -0,0 +1,88 @@
+/**
+ * @file SocEstimator.h
+ * @brief Fixed-point Battery State-of-Charge Estimator
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef SOCESTIMATOR_H
+#define SOCESTIMATOR_H
+
+#include <QtGlobal>
+
+/**
+ * @class SocEstimator
+ * @brief C++ port of the bridge's BatteryMonitor with coulomb counting
+ *
+ * Per sample:
+ * 1. 7-sample windowed median of the pack voltage (spike rejection)
+ * 2. Per-cell OCV -> SOC from a dense 1 mV lookup table (LiPo curve),
+ *    interpolated between entries
+ * 3. Coulomb counting: SOC -= I * dt / capacity
+ * 4. EMA pull toward the OCV estimate, alpha given per 0.5 s (the bridge's
+ *    sample period) and scaled by dt so any sample rate behaves the same
+ * 5. Slew limit: +2 %/s, -3 %/s
+ *
+ * Internals are integer: voltage in uV, SOC in micro-percent, charge in
+ * 0.1 mA * us, so one 100 Hz update is a handful of integer ops.
+ * Current is positive while discharging.
+ */
+class SocEstimator
+{
+public:
+    explicit SocEstimator(float capacityMah = 2500.0f, float alpha = 0.12f);
+
+    // Returns the updated SOC in percent.
+    float update(float voltage, float currentMa, qint64 timestampNs);
+    void reset();
+
+    float socPercent() const { return m_socMicroPct / 1e6f; }
+    float stableVoltage() const { return m_stableUv / 1e6f; }
+    float chargeUsedMah() const;
+    bool isInitialized() const { return m_initialized; }
+
+    // OCV-only estimate for a pack voltage (cell count auto-detected)
+    static float ocvPercent(float voltage);
+    static int detectCellCount(qint32 packUv);
+
+    static constexpr int MEDIAN_WINDOW = 7;
+
+private:
+    /**
+     * Fixed window kept both in arrival order (for eviction) and sorted
+     * (for the median). Window size is a small constant, so each push is O(1).
+     */
+    class MedianWindow
+    {
+    public:
+        MedianWindow() : m_count(0), m_oldest(0) {}
+        qint32 push(qint32 value);
+        void clear() { m_count = 0; m_oldest = 0; }
+
+    private:
+        qint32 m_arrival[MEDIAN_WINDOW];
+        qint32 m_sorted[MEDIAN_WINDOW];
+        int m_count;
+        int m_oldest;
+    };
+
+    static qint32 ocvMicroPercent(qint32 packUv);
+
+    static constexpr qint32 FULL_MICRO_PCT = 100000000;       // 100 %
+    static constexpr qint64 ALPHA_INTERVAL_US = 500000;       // Bridge sample period
+    static constexpr qint64 SLEW_UP_MICRO_PCT_PER_S = 2000000;
+    static constexpr qint64 SLEW_DOWN_MICRO_PCT_PER_S = 3000000;
+    static constexpr qint64 MAX_DT_US = 1000000;              // Ignore longer gaps
+
+    const qint64 m_chargePerMicroPct;   // 0.1 mA * us per micro-percent
+    const qint64 m_alphaQ16;
+    MedianWindow m_median;
+    bool m_initialized;
+    qint64 m_lastTimestampNs;
+    qint32 m_stableUv;
+    qint64 m_socMicroPct;
+    qint64 m_chargeResidual;            // Sub-step charge carried to the next update
+    qint64 m_chargeUsedDeciMaUs;
+};
+
+#endif // SOCESTIMATOR_H
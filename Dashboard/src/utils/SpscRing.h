@@ -0,0 +1,76 @@
+/**
+ * @file SpscRing.h
+ * @brief Lock-free Single-Producer/Single-Consumer Ring Buffer
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class SpscRing
+ * @brief Fixed-size lock-free ring for one producer thread and one consumer thread
+ *
+ * Features:
+ * - No allocation after construction
+ * - Capacity must be a power of two (one slot is never used)
+ * - push() fails instead of overwriting when the consumer falls behind
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : m_head(0), m_tail(0) {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    // Producer side
+    bool push(const T &item)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        const std::size_t next = (head + 1) & MASK;
+        if (next == m_tail.load(std::memory_order_acquire)) {
+            return false;  // Full
+        }
+        m_slots[head] = item;
+        m_head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T &item)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            return false;  // Empty
+        }
+        item = m_slots[tail];
+        m_tail.store((tail + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    bool isEmpty() const
+    {
+        return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() { return Capacity - 1; }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    T m_slots[Capacity];
+    // Keep producer and consumer indices on separate cache lines.
+    alignas(64) std::atomic<std::size_t> m_head;
+    alignas(64) std::atomic<std::size_t> m_tail;
+};
+
+#endif // SPSCRING_H
@@ -0,0 +1,109 @@
+/**
+ * @file StartupTimeline.cpp
+ * @brief Startup Timeline Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "StartupTimeline.h"
+#include <QByteArray>
+#include <QFile>
+#include <QList>
+#include <QString>
+#include <QDebug>
+
+#include <ctime>
+#include <unistd.h>
+
+StartupTimeline &StartupTimeline::instance()
+{
+    static StartupTimeline timeline;
+    return timeline;
+}
+
+StartupTimeline::StartupTimeline()
+    : m_preMainNs(0)
+{
+    for (int i = 0; i < MilestoneCount; ++i) {
+        m_markNs[i] = -1;
+    }
+}
+
+void StartupTimeline::begin()
+{
+    m_preMainNs = readPreMainNs();
+    m_clock.start();
+    mark(MainEntered);
+}
+
+void StartupTimeline::record(Milestone milestone)
+{
+    if (!m_clock.isValid()) {
+        m_clock.start();
+    }
+    m_markNs[milestone] = m_preMainNs + m_clock.nsecsElapsed();
+}
+
+qint64 StartupTimeline::readPreMainNs()
+{
+    // Field 22 of /proc/self/stat is the process start time in clock ticks
+    // since boot, on the same base as CLOCK_BOOTTIME.
+    QFile file(QStringLiteral("/proc/self/stat"));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    const QByteArray stat = file.readAll();
+    file.close();
+
+    // comm (field 2) may contain spaces; fields after it start past the last ')'.
+    const int commEnd = stat.lastIndexOf(')');
+    if (commEnd < 0) {
+        return 0;
+    }
+    const QList<QByteArray> fields = stat.mid(commEnd + 2).split(' ');
+    const int startTimeIndex = 22 - 3;  // First field after comm is field 3
+    if (fields.size() <= startTimeIndex) {
+        return 0;
+    }
+
+    bool ok = false;
+    const qint64 startTicks = fields.at(startTimeIndex).toLongLong(&ok);
+    const long ticksPerSecond = ::sysconf(_SC_CLK_TCK);
+    struct timespec now;
+    if (!ok || ticksPerSecond <= 0 || ::clock_gettime(CLOCK_BOOTTIME, &now) != 0) {
+        return 0;
+    }
+
+    const qint64 nowNs = static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+    const qint64 startNs = startTicks * (1000000000LL / ticksPerSecond);
+    return qMax<qint64>(0, nowNs - startNs);
+}
+
+const char *StartupTimeline::milestoneName(Milestone milestone)
+{
+    switch (milestone) {
+    case MainEntered:        return "main() entered";
+    case WindowConstructed:  return "window constructed";
+    case FirstFrame:         return "first frame";
+    case TelemetryStarted:   return "telemetry started";
+    case FirstCanSample:     return "first CAN sample";
+    case FirstBatterySample: return "first battery sample";
+    case MilestoneCount:     break;
+    }
+    return "?";
+}
+
+void StartupTimeline::print() const
+{
+    qDebug() << "Startup timeline (ms since process start):";
+    for (int i = 0; i < MilestoneCount; ++i) {
+        const Milestone milestone = static_cast<Milestone>(i);
+        const QString name = QString::fromLatin1(milestoneName(milestone)).leftJustified(22);
+        if (m_markNs[i] < 0) {
+            qDebug().noquote() << " " << name << "not reached";
+            continue;
+        }
+        qDebug().noquote() << " " << name
+                           << QString::number(m_markNs[i] / 1e6, 'f', 1).rightJustified(9);
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file StartupTimeline.h
+ * @brief Power-on to first-data Startup Milestones
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef STARTUPTIMELINE_H
+#define STARTUPTIMELINE_H
+
+#include <QElapsedTimer>
+#include <QtGlobal>
+
+/**
+ * @class StartupTimeline
+ * @brief Records when each startup milestone was first reached
+ *
+ * Features:
+ * - Times are relative to process start (taken from /proc/self/stat, so
+ *   dynamic loading before main() is included)
+ * - Only the first mark() of a milestone counts; later calls are a cheap
+ *   flag check, safe to leave in per-sample paths
+ * - print() dumps the timeline at exit
+ *
+ * GUI thread only.
+ */
+class StartupTimeline
+{
+public:
+    enum Milestone {
+        MainEntered,
+        WindowConstructed,
+        FirstFrame,
+        TelemetryStarted,
+        FirstCanSample,
+        FirstBatterySample,
+        MilestoneCount
+    };
+
+    static StartupTimeline &instance();
+
+    // Call first thing in main(); starts the clock.
+    void begin();
+
+    void mark(Milestone milestone)
+    {
+        if (m_markNs[milestone] < 0) {
+            record(milestone);
+        }
+    }
+
+    bool reached(Milestone milestone) const { return m_markNs[milestone] >= 0; }
+    // Nanoseconds since process start, -1 if not reached
+    qint64 elapsedNs(Milestone milestone) const { return m_markNs[milestone]; }
+
+    void print() const;
+
+private:
+    StartupTimeline();
+
+    void record(Milestone milestone);
+    static qint64 readPreMainNs();
+    static const char *milestoneName(Milestone milestone);
+
+    QElapsedTimer m_clock;
+    qint64 m_preMainNs;  // Process start -> begin()
+    qint64 m_markNs[MilestoneCount];
+};
+
+#endif // STARTUPTIMELINE_H
@@ -0,0 +1,82 @@
+/**
+ * @file TelemetryRecord.h
+ * @brief Fixed-layout Records of the Memory-mapped Telemetry Ring File
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef TELEMETRYRECORD_H
+#define TELEMETRYRECORD_H
+
+#include <QtGlobal>
+#include <cstddef>
+
+/**
+ * @struct TelemetryRingHeader
+ * @brief First bytes of the ring file; records start at HEADER_SIZE
+ *
+ * Little-endian. tools/ring_dump.py unpacks it with "<IHHIIIIqQII";
+ * bump VERSION on any layout change.
+ */
+struct TelemetryRingHeader
+{
+    static constexpr quint32 MAGIC = 0x52545250;   // "PRTR"
+    static constexpr quint16 VERSION = 1;
+    static constexpr quint32 HEADER_SIZE = 4096;   // Keeps records page-aligned
+
+    quint32 magic;
+    quint16 version;
+    quint16 reserved0;
+    quint32 headerSize;
+    quint32 recordSize;
+    quint32 capacity;       // Records, power of two
+    quint32 retentionSec;   // Configured retention when the file was last opened
+    qint64 createdNs;       // CLOCK_REALTIME
+    quint64 writeIndex;     // Next record to claim; atomic
+    quint32 sessions;       // Number of dashboard runs that opened the file
+    quint32 reserved1;
+};
+
+/**
+ * @struct TelemetryRecord
+ * @brief One decoded sample, 32 bytes; "<QqfHHII" in Python
+ *
+ * sequence is the claim index + 1 and is stored last with release order,
+ * so a record whose sequence does not match its slot was never completed.
+ */
+struct TelemetryRecord
+{
+    enum Kind : quint16 {
+        KIND_SESSION_START = 0,   // value = 0, aux = session number
+        KIND_SPEED_KMH = 1,
+        KIND_WHEEL_RPM = 2,
+        KIND_CAN_SIGNAL = 3,      // Other decoded CAN signal, aux = CAN ID
+        KIND_BATTERY_VOLTAGE = 4,
+        KIND_BATTERY_CURRENT_MA = 5,
+        KIND_BATTERY_PERCENT = 6,
+        KIND_DIRECTION = 7        // 1 = F, 0 = N, -1 = R
+    };
+
+    enum Source : quint16 {
+        SOURCE_DASHBOARD = 0,
+        SOURCE_CAN = 1,
+        SOURCE_INA219 = 2,
+        SOURCE_BRIDGE = 3,
+        SOURCE_DRIVE_MODE = 4
+    };
+
+    quint64 sequence;
+    qint64 timestampNs;     // CLOCK_REALTIME; kernel receive time for CAN
+    float value;
+    quint16 kind;
+    quint16 source;
+    quint32 aux;            // CAN ID, bridge packet sequence, ...
+    quint32 reserved;
+};
+
+static_assert(sizeof(TelemetryRingHeader) == 48, "TelemetryRingHeader layout is part of the file format");
+static_assert(offsetof(TelemetryRingHeader, writeIndex) == 32, "TelemetryRingHeader layout drifted");
+static_assert(sizeof(TelemetryRecord) == 32, "TelemetryRecord layout is part of the file format");
+static_assert(offsetof(TelemetryRecord, kind) == 20, "TelemetryRecord layout drifted");
+
+#endif // TELEMETRYRECORD_H
@@ -0,0 +1,183 @@
+/**
+ * @file TelemetryRecorder.cpp
+ * @brief Telemetry Recorder Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "TelemetryRecorder.h"
+#include <QFile>
+#include <QDebug>
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TelemetryRecorder::TelemetryRecorder()
+    : m_fd(-1)
+    , m_mapping(nullptr)
+    , m_mappingSize(0)
+    , m_header(nullptr)
+    , m_records(nullptr)
+    , m_capacity(0)
+    , m_indexMask(0)
+{
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+    close();
+}
+
+qint64 TelemetryRecorder::nowNs()
+{
+    struct timespec now;
+    ::clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+bool TelemetryRecorder::headerMatches(int fd, qint64 fileSize) const
+{
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size != fileSize) {
+        return false;
+    }
+    TelemetryRingHeader header;
+    if (::pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        return false;
+    }
+    return header.magic == TelemetryRingHeader::MAGIC &&
+           header.version == TelemetryRingHeader::VERSION &&
+           header.headerSize == TelemetryRingHeader::HEADER_SIZE &&
+           header.recordSize == sizeof(TelemetryRecord) &&
+           header.capacity == m_capacity;
+}
+
+bool TelemetryRecorder::open(const QString &path, int retentionSec, int maxRateHz)
+{
+    close();
+
+    // Enough slots for the retention window at the worst-case sample rate.
+    const quint64 wanted = qMax<quint64>(1024, static_cast<quint64>(qMax(1, retentionSec)) *
+                                                   static_cast<quint64>(qMax(1, maxRateHz)));
+    quint64 capacity = 1;
+    while (capacity < wanted && capacity < (1ULL << 26)) {
+        capacity <<= 1;
+    }
+    m_capacity = static_cast<quint32>(capacity);
+    const qint64 fileSize = TelemetryRingHeader::HEADER_SIZE +
+                            static_cast<qint64>(capacity) * sizeof(TelemetryRecord);
+
+    m_fd = ::open(QFile::encodeName(path).constData(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        qWarning() << "Telemetry recorder: cannot open" << path << "errno" << errno;
+        return false;
+    }
+
+    // Keep an existing ring of the same geometry; anything else starts empty.
+    const bool reuse = headerMatches(m_fd, fileSize);
+    if (!reuse) {
+        if (::ftruncate(m_fd, 0) != 0) {
+            qWarning() << "Telemetry recorder: truncate failed, errno" << errno;
+            close();
+            return false;
+        }
+        // Reserve the blocks now so a full disk shows up here, not as SIGBUS later.
+        // Only a filesystem without fallocate support falls back to a sparse
+        // file; ENOSPC and other errors stop recording.
+        const int error = ::posix_fallocate(m_fd, 0, fileSize);
+        const bool unsupported = (error == EOPNOTSUPP || error == EINVAL);
+        if (error != 0 && !unsupported) {
+            qWarning() << "Telemetry recorder: cannot reserve" << fileSize << "bytes for"
+                       << path << "error" << error;
+            close();
+            return false;
+        }
+        if (unsupported && ::ftruncate(m_fd, fileSize) != 0) {
+            qWarning() << "Telemetry recorder: cannot size" << path << "errno" << errno;
+            close();
+            return false;
+        }
+    }
+
+    m_mappingSize = static_cast<size_t>(fileSize);
+    m_mapping = ::mmap(nullptr, m_mappingSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, m_fd, 0);
+    if (m_mapping == MAP_FAILED) {
+        m_mapping = nullptr;
+        qWarning() << "Telemetry recorder: mmap failed, errno" << errno;
+        close();
+        return false;
+    }
+
+    m_header = static_cast<TelemetryRingHeader *>(m_mapping);
+    if (!reuse) {
+        std::memset(m_header, 0, sizeof(TelemetryRingHeader));
+        m_header->magic = TelemetryRingHeader::MAGIC;
+        m_header->version = TelemetryRingHeader::VERSION;
+        m_header->headerSize = TelemetryRingHeader::HEADER_SIZE;
+        m_header->recordSize = sizeof(TelemetryRecord);
+        m_header->capacity = m_capacity;
+        m_header->createdNs = nowNs();
+    }
+    m_header->retentionSec = static_cast<quint32>(qMax(0, retentionSec));
+    m_header->sessions += 1;
+
+    m_path = path;
+    m_indexMask = capacity - 1;
+    m_records = reinterpret_cast<TelemetryRecord *>(
+        static_cast<char *>(m_mapping) + TelemetryRingHeader::HEADER_SIZE);
+
+    record(TelemetryRecord::KIND_SESSION_START, TelemetryRecord::SOURCE_DASHBOARD,
+           0.0f, nowNs(), m_header->sessions);
+
+    qDebug() << "Telemetry recorder:" << path << m_capacity << "records,"
+             << (reuse ? "continuing at" : "new file, at") << recordsWritten();
+    return true;
+}
+
+void TelemetryRecorder::close()
+{
+    m_records = nullptr;
+    m_header = nullptr;
+    if (m_mapping) {
+        // Not needed for crash safety (page cache), only to start writeback.
+        ::msync(m_mapping, m_mappingSize, MS_ASYNC);
+        ::munmap(m_mapping, m_mappingSize);
+        m_mapping = nullptr;
+    }
+    m_mappingSize = 0;
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+quint64 TelemetryRecorder::recordsWritten() const
+{
+    return m_header ? __atomic_load_n(&m_header->writeIndex, __ATOMIC_RELAXED) : 0;
+}
+
+void TelemetryRecorder::write(TelemetryRecord::Kind kind, TelemetryRecord::Source source,
+                              float value, qint64 timestampNs, quint32 aux)
+{
+    const quint64 index = __atomic_fetch_add(&m_header->writeIndex, 1, __ATOMIC_RELAXED);
+    TelemetryRecord &slot = m_records[index & m_indexMask];
+
+    // Invalidate first so a reader never pairs the old sequence with new fields.
+    __atomic_store_n(&slot.sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot.timestampNs = timestampNs;
+    slot.value = value;
+    slot.kind = kind;
+    slot.source = source;
+    slot.aux = aux;
+    slot.reserved = 0;
+
+    __atomic_store_n(&slot.sequence, index + 1, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file TelemetryRecorder.h
+ * @brief Crash-safe Telemetry Recorder on a Memory-mapped Ring File
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef TELEMETRYRECORDER_H
+#define TELEMETRYRECORDER_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include "TelemetryRecord.h"
+
+/**
+ * @class TelemetryRecorder
+ * @brief Appends every decoded sample to a preallocated mmap'd ring of TelemetryRecord
+ *
+ * Features:
+ * - File is sized once (retention x max rate, rounded up to a power of
+ *   two) with posix_fallocate and mapped MAP_SHARED | MAP_POPULATE
+ * - record() claims a slot with one atomic add on the shared header and
+ *   writes in place: lock-free, no syscalls, no heap allocation, callable
+ *   from the CAN ingest thread, the INA219 thread and the GUI thread
+ * - Pages live in the page cache, so records written before a crash or
+ *   kill are still in the file; a reopen continues after them
+ * - Oldest records are overwritten once the ring wraps
+ *
+ * Read the file with tools/ring_dump.py. Power loss can still lose the
+ * last writeback interval; that is not covered here.
+ */
+class TelemetryRecorder
+{
+public:
+    TelemetryRecorder();
+    ~TelemetryRecorder();
+
+    bool open(const QString &path, int retentionSec, int maxRateHz);
+    // Producers must have stopped calling record() before this.
+    void close();
+    bool isOpen() const { return m_records != nullptr; }
+
+    void record(TelemetryRecord::Kind kind, TelemetryRecord::Source source,
+                float value, qint64 timestampNs, quint32 aux = 0)
+    {
+        if (m_records) {
+            write(kind, source, value, timestampNs, aux);
+        }
+    }
+
+    QString path() const { return m_path; }
+    quint32 capacity() const { return m_capacity; }
+    quint64 recordsWritten() const;
+
+    // CLOCK_REALTIME, the base of every record timestamp
+    static qint64 nowNs();
+
+private:
+    void write(TelemetryRecord::Kind kind, TelemetryRecord::Source source,
+               float value, qint64 timestampNs, quint32 aux);
+    bool headerMatches(int fd, qint64 fileSize) const;
+
+    QString m_path;
+    int m_fd;
+    void *m_mapping;
+    size_t m_mappingSize;
+    TelemetryRingHeader *m_header;
+    TelemetryRecord *m_records;
+    quint32 m_capacity;
+    quint64 m_indexMask;
+};
+
+#endif // TELEMETRYRECORDER_H
@@ -0,0 +1,90 @@
+/**
+ * @file UnixSignalNotifier.cpp
+ * @brief Unix Signal Notifier Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "UnixSignalNotifier.h"
+#include <QSocketNotifier>
+#include <QDebug>
+
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+
+int UnixSignalNotifier::s_writeFds[UnixSignalNotifier::MAX_SIGNAL] = {};
+
+UnixSignalNotifier::UnixSignalNotifier(int signalNumber, QObject *parent)
+    : QObject(parent)
+    , m_signalNumber(signalNumber)
+    , m_readFd(-1)
+    , m_writeFd(-1)
+    , m_notifier(nullptr)
+{
+    if (signalNumber <= 0 || signalNumber >= MAX_SIGNAL || s_writeFds[signalNumber] > 0) {
+        qWarning() << "Cannot watch signal" << signalNumber;
+        return;
+    }
+
+    int fds[2];
+    if (::pipe2(fds, O_NONBLOCK | O_CLOEXEC) != 0) {
+        qWarning() << "Signal pipe failed, errno" << errno;
+        return;
+    }
+    m_readFd = fds[0];
+    m_writeFd = fds[1];
+    s_writeFds[signalNumber] = m_writeFd;
+
+    struct sigaction action = {};
+    action.sa_handler = &UnixSignalNotifier::handleSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (::sigaction(signalNumber, &action, nullptr) != 0) {
+        qWarning() << "sigaction failed for signal" << signalNumber << "errno" << errno;
+        s_writeFds[signalNumber] = 0;
+        ::close(m_readFd);
+        ::close(m_writeFd);
+        m_readFd = m_writeFd = -1;
+        return;
+    }
+
+    m_notifier = new QSocketNotifier(m_readFd, QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated,
+            this, &UnixSignalNotifier::onPipeReadable);
+}
+
+UnixSignalNotifier::~UnixSignalNotifier()
+{
+    if (!m_notifier) {
+        return;
+    }
+    ::signal(m_signalNumber, SIG_DFL);
+    s_writeFds[m_signalNumber] = 0;
+    m_notifier->setEnabled(false);
+    ::close(m_readFd);
+    ::close(m_writeFd);
+}
+
+void UnixSignalNotifier::handleSignal(int signalNumber)
+{
+    // Async-signal-safe: one write(), errno preserved for the interrupted code.
+    const int savedErrno = errno;
+    const int fd = s_writeFds[signalNumber];
+    if (fd > 0) {
+        const char byte = 1;
+        ssize_t ignored = ::write(fd, &byte, 1);
+        Q_UNUSED(ignored);
+    }
+    errno = savedErrno;
+}
+
+void UnixSignalNotifier::onPipeReadable()
+{
+    // Several signals may have queued up; they collapse into one notification.
+    char buffer[32];
+    while (::read(m_readFd, buffer, sizeof(buffer)) > 0) {
+    }
+    emit activated(m_signalNumber);
+}
@@ -0,0 +1,52 @@
+/**
+ * @file UnixSignalNotifier.h
+ * @brief POSIX Signal to Qt Signal Bridge (self-pipe)
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef UNIXSIGNALNOTIFIER_H
+#define UNIXSIGNALNOTIFIER_H
+
+#include <QObject>
+
+class QSocketNotifier;
+
+/**
+ * @class UnixSignalNotifier
+ * @brief Delivers a POSIX signal (e.g. SIGUSR1) as a Qt signal on the GUI thread
+ *
+ * The handler only writes one byte to a non-blocking pipe; a QSocketNotifier
+ * on the read end emits activated() from the event loop, where any work is
+ * safe. One instance per signal number.
+ */
+class UnixSignalNotifier : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit UnixSignalNotifier(int signalNumber, QObject *parent = nullptr);
+    ~UnixSignalNotifier();
+
+    bool isValid() const { return m_notifier != nullptr; }
+    int signalNumber() const { return m_signalNumber; }
+
+signals:
+    void activated(int signalNumber);
+
+private slots:
+    void onPipeReadable();
+
+private:
+    static void handleSignal(int signalNumber);
+
+    static constexpr int MAX_SIGNAL = 64;
+    static int s_writeFds[MAX_SIGNAL];
+
+    int m_signalNumber;
+    int m_readFd;
+    int m_writeFd;
+    QSocketNotifier *m_notifier;
+};
+
+#endif // UNIXSIGNALNOTIFIER_H
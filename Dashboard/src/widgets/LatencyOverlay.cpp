@@ -0,0 +1,66 @@
+/**
+ * @file LatencyOverlay.cpp
+ * @brief Latency Overlay Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "LatencyOverlay.h"
+#include "LatencyTracer.h"
+#include <QPainter>
+#include <QFont>
+#include <QTimer>
+
+LatencyOverlay::LatencyOverlay(QWidget *parent)
+    : QWidget(parent)
+    , m_refreshTimer(nullptr)
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setFixedSize(410, 126);
+
+    m_refreshTimer = new QTimer(this);
+    connect(m_refreshTimer, &QTimer::timeout, this, &LatencyOverlay::refresh);
+}
+
+void LatencyOverlay::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    refresh();
+    m_refreshTimer->start(REFRESH_INTERVAL_MS);
+}
+
+void LatencyOverlay::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+    m_refreshTimer->stop();
+}
+
+void LatencyOverlay::refresh()
+{
+    QString text = LatencyTracer::instance().report();
+    if (m_statusSource) {
+        text += m_statusSource();  // report() ends with a newline
+    }
+    if (text != m_text) {
+        m_text = text;
+        update();
+    }
+}
+
+void LatencyOverlay::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 170));
+    painter.drawRoundedRect(rect(), 6, 6);
+
+    QFont font("DejaVu Sans Mono");
+    font.setStyleHint(QFont::Monospace);
+    font.setPixelSize(11);
+    painter.setFont(font);
+    painter.setPen(QColor("#7CFC9A"));
+    painter.drawText(rect().adjusted(8, 6, -8, -6), Qt::AlignLeft | Qt::AlignTop, m_text);
+}
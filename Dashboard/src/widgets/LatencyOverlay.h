@@ -0,0 +1,54 @@
+/**
+ * @file LatencyOverlay.h
+ * @brief Debug Overlay for Sensor-to-Display Latency
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef LATENCYOVERLAY_H
+#define LATENCYOVERLAY_H
+
+#include <QWidget>
+#include <QString>
+#include <functional>
+
+class QTimer;
+
+/**
+ * @class LatencyOverlay
+ * @brief Semi-transparent p50/p95/p99 table from LatencyTracer
+ *
+ * Features:
+ * - Refreshes twice a second, only while visible
+ * - Ignores mouse input so the dashboard underneath stays usable
+ * - Toggled with F3 or "debug.latency_overlay" in the config
+ * - Optional status lines below the table (CAN bus health) so stalls can
+ *   be matched with bus problems at a glance
+ */
+class LatencyOverlay : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit LatencyOverlay(QWidget *parent = nullptr);
+
+    // Polled on every refresh; appended below the latency table.
+    void setStatusSource(std::function<QString()> source) { m_statusSource = std::move(source); }
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    void refresh();
+
+private:
+    QString m_text;
+    QTimer *m_refreshTimer;
+    std::function<QString()> m_statusSource;
+
+    static constexpr int REFRESH_INTERVAL_MS = 500;
+};
+
+#endif // LATENCYOVERLAY_H
@@ -7,63 +7,197 @@
 
 #include "RpmGauge.h"
 #include <QPainter>
+#include <QPaintEvent>
 #include <QFont>
 #include <QtMath>
-#include <QEasingCurve>
 
 RpmGauge::RpmGauge(QWidget *parent)
     : QWidget(parent)
     , m_rpm(0.0f)
-    , m_needleAngle(200.0f)
-    , m_needleAnimation(nullptr)
+    , m_needleAngle(START_ANGLE)
+    , m_needle(0.18f, START_ANGLE)
+    , m_staticLayerDirty(true)
 {
-    m_needleAnimation = new QPropertyAnimation(this, "needleAngle");
-    m_needleAnimation->setDuration(180);
-    m_needleAnimation->setEasingCurve(QEasingCurve::OutCubic);
 }
 
-void RpmGauge::setRPM(float rpm)
+float RpmGauge::rpmToAngle(float rpm)
 {
-    m_rpm = qBound(0.0f, rpm, MAX_RPM);
     // Motorsport-style sweep with slight headroom.
-    const float startAngle = 200.0f;
-    const float endAngle = -20.0f;
     const float displayMax = MAX_RPM * 1.15f;
-    const float normalized = qBound(0.0f, m_rpm / displayMax, 1.0f);
-    const float targetAngle = startAngle + (endAngle - startAngle) * normalized;
-    m_needleAnimation->stop();
-    m_needleAnimation->setStartValue(m_needleAngle);
-    m_needleAnimation->setEndValue(targetAngle);
-    m_needleAnimation->start();
+    const float normalized = qBound(0.0f, rpm / displayMax, 1.0f);
+    return START_ANGLE + (END_ANGLE - START_ANGLE) * normalized;
+}
+
+void RpmGauge::setRPM(float rpm)
+{
+    const float oldRpm = m_rpm;
+    m_rpm = qBound(0.0f, rpm, MAX_RPM);
+
+    // Invalidate only what changed: the arc between old and new value,
+    // the number, and the needle if it changes colour.
+    const int radius = gaugeRadius();
+    const float oldArc = rpmToAngle(oldRpm);
+    const float newArc = rpmToAngle(m_rpm);
+    if (oldArc != newArc) {
+        update(sweepRect(oldArc, newArc, radius, radius, 5));
+    }
+    if (static_cast<int>(oldRpm) != static_cast<int>(m_rpm)) {
+        update(valueRect());
+    }
+    const float redLine = MAX_RPM * 0.8f;
+    if ((oldRpm > redLine) != (m_rpm > redLine)) {
+        update(sweepRect(m_needleAngle, m_needleAngle,
+                         radius - NEEDLE_INNER_OFFSET, radius - NEEDLE_OUTER_OFFSET, 4));
+    }
+
+    m_needle.setTarget(newArc);
+}
+
+void RpmGauge::advance(float dtSeconds)
+{
+    if (m_needle.advance(dtSeconds)) {
+        moveNeedle(m_needle.value());
+    }
+}
+
+float RpmGauge::needleLag() const
+{
+    // Angle decreases as RPM rises.
+    return m_needle.lag() * (MAX_RPM * 1.15f) / (START_ANGLE - END_ANGLE);
 }
 
 void RpmGauge::setNeedleAngle(float angle)
 {
-    m_needleAngle = qBound(-20.0f, angle, 200.0f);
-    update();
+    m_needle.reset(angle);
+    moveNeedle(angle);
+}
+
+void RpmGauge::moveNeedle(float angle)
+{
+    const float oldAngle = m_needleAngle;
+    m_needleAngle = qBound(END_ANGLE, angle, START_ANGLE);
+    if (m_needleAngle == oldAngle) {
+        return;
+    }
+
+    const int radius = gaugeRadius();
+    update(sweepRect(oldAngle, m_needleAngle,
+                     radius - NEEDLE_INNER_OFFSET, radius - NEEDLE_OUTER_OFFSET, 4));
+}
+
+QPointF RpmGauge::gaugeCenter() const
+{
+    return QPointF(width() / 2, static_cast<int>(height() * 0.78f));
+}
+
+int RpmGauge::gaugeRadius() const
+{
+    return qMin(static_cast<int>(width() * 0.48f), static_cast<int>(height() * 0.70f));
+}
+
+QRect RpmGauge::valueRect() const
+{
+    const int cx = width() / 2;
+    const int cy = static_cast<int>(height() * 0.74f);
+    // 46pt glyphs overhang the 60 px layout box slightly.
+    return QRect(cx - 100, cy - 62, 200, 60).adjusted(-4, -10, 4, 10);
+}
+
+QRect RpmGauge::sweepRect(float fromDeg, float toDeg, float innerRadius, float outerRadius,
+                          int pad) const
+{
+    const float lo = qMin(fromDeg, toDeg);
+    const float hi = qMax(fromDeg, toDeg);
+    const QPointF c = gaugeCenter();
+    auto pointAt = [&c](float deg, float r) {
+        const float a = qDegreesToRadians(deg);
+        return QPointF(c.x() + qCos(a) * r, c.y() - qSin(a) * r);
+    };
+
+    // Bounding box of an annular sector: its four corners plus any axis
+    // extreme of the outer circle the sweep crosses.
+    qreal left = c.x(), right = c.x(), top = c.y(), bottom = c.y();
+    bool first = true;
+    auto include = [&](const QPointF &p) {
+        if (first) {
+            left = right = p.x();
+            top = bottom = p.y();
+            first = false;
+            return;
+        }
+        left = qMin(left, p.x());
+        right = qMax(right, p.x());
+        top = qMin(top, p.y());
+        bottom = qMax(bottom, p.y());
+    };
+    include(pointAt(lo, innerRadius));
+    include(pointAt(lo, outerRadius));
+    include(pointAt(hi, innerRadius));
+    include(pointAt(hi, outerRadius));
+    for (float axis = qCeil(lo / 90.0f) * 90.0f; axis <= hi; axis += 90.0f) {
+        include(pointAt(axis, outerRadius));
+    }
+    const QRectF bounds(QPointF(left, top), QPointF(right, bottom));
+    return bounds.toAlignedRect().adjusted(-pad, -pad, pad, pad);
 }
 
 void RpmGauge::paintEvent(QPaintEvent *event)
 {
-    Q_UNUSED(event);
-    
+    if (m_staticLayerDirty || m_staticLayer.devicePixelRatio() != devicePixelRatioF()) {
+        rebuildStaticLayer();
+    }
+
     QPainter painter(this);
+    // Blit only the invalidated part of the cache (source is in device pixels).
+    const QRect dirty = event->rect();
+    const qreal dpr = m_staticLayer.devicePixelRatio();
+    painter.drawPixmap(QRectF(dirty), m_staticLayer,
+                       QRectF(dirty.x() * dpr, dirty.y() * dpr,
+                              dirty.width() * dpr, dirty.height() * dpr));
     painter.setRenderHint(QPainter::Antialiasing);
-    
-    drawGauge(&painter);
-    drawValue(&painter);
+
+    drawActiveArc(&painter);
+    drawNeedle(&painter);
+    if (dirty.intersects(valueRect())) {
+        drawValue(&painter);
+    }
 }
 
-void RpmGauge::drawGauge(QPainter *painter)
+void RpmGauge::resizeEvent(QResizeEvent *event)
 {
-    const int cx = width() / 2;
-    const int cy = static_cast<int>(height() * 0.78f);
-    const int radius = qMin(static_cast<int>(width() * 0.48f), static_cast<int>(height() * 0.70f));
-    const float startDeg = 200.0f;
-    const float endDeg = -20.0f;
+    QWidget::resizeEvent(event);
+    m_staticLayerDirty = true;
+}
+
+void RpmGauge::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::StyleChange || event->type() == QEvent::PaletteChange
+        || event->type() == QEvent::FontChange) {
+        m_staticLayerDirty = true;
+        update();
+    }
+    QWidget::changeEvent(event);
+}
+
+void RpmGauge::rebuildStaticLayer()
+{
+    const qreal dpr = devicePixelRatioF();
+    m_staticLayer = QPixmap(qMax(1, qRound(width() * dpr)), qMax(1, qRound(height() * dpr)));
+    m_staticLayer.setDevicePixelRatio(dpr);
+    m_staticLayer.fill(Qt::transparent);
+
+    QPainter painter(&m_staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing);
+    drawStaticGauge(&painter);
+    m_staticLayerDirty = false;
+}
+
+void RpmGauge::drawStaticGauge(QPainter *painter)
+{
+    const int radius = gaugeRadius();
     
     painter->save();
-    painter->translate(cx, cy);
+    painter->translate(gaugeCenter());
     
     QPen pen;
     painter->setBrush(Qt::NoBrush);
@@ -74,25 +208,14 @@ void RpmGauge::drawGauge(QPainter *painter)
     pen.setCapStyle(Qt::RoundCap);
     painter->setPen(pen);
     painter->drawArc(-radius, -radius, radius * 2, radius * 2,
-                     static_cast<int>(startDeg * 16),
-                     static_cast<int>((endDeg - startDeg) * 16));
-    
-    // Active arc
-    float normalized = qBound(0.0f, m_rpm / (MAX_RPM * 1.15f), 1.0f);
-    float angleNow = startDeg + (endDeg - startDeg) * normalized;
-    pen.setColor(QColor("#00D4FF"));
-    pen.setWidth(6);
-    pen.setCapStyle(Qt::RoundCap);
-    painter->setPen(pen);
-    painter->drawArc(-radius, -radius, radius * 2, radius * 2,
-                     static_cast<int>(startDeg * 16),
-                     static_cast<int>((angleNow - startDeg) * 16));
+                     static_cast<int>(START_ANGLE * 16),
+                     static_cast<int>((END_ANGLE - START_ANGLE) * 16));
     
     // Tick marks
     constexpr int tickCount = 24;
     for (int i = 0; i <= tickCount; ++i) {
         const float t = static_cast<float>(i) / tickCount;
-        const float angleDeg = startDeg + (endDeg - startDeg) * t;
+        const float angleDeg = START_ANGLE + (END_ANGLE - START_ANGLE) * t;
         const float a = qDegreesToRadians(angleDeg);
         const bool major = (i % 4 == 0);
         const float r1 = radius - (major ? 19.0f : 15.0f);
@@ -106,12 +229,51 @@ void RpmGauge::drawGauge(QPainter *painter)
         painter->drawLine(p1, p2);
     }
 
+    painter->restore();
+
+    // Place label directly under the RPM number.
+    const int cx = width() / 2;
+    const int cy = static_cast<int>(height() * 0.74f);
+    QRect labelRect(cx - 72, cy - 8, 144, 20);
+    QFont font("Roboto", 9, QFont::Medium);
+    painter->setFont(font);
+    painter->setPen(QColor("#9FB4CB"));
+    painter->drawText(labelRect, Qt::AlignHCenter | Qt::AlignVCenter, "Wheel RPM");
+}
+
+void RpmGauge::drawActiveArc(QPainter *painter)
+{
+    const int radius = gaugeRadius();
+    const float angleNow = rpmToAngle(m_rpm);
+
+    painter->save();
+    painter->translate(gaugeCenter());
+
+    QPen pen(QColor("#00D4FF"));
+    pen.setWidth(6);
+    pen.setCapStyle(Qt::RoundCap);
+    painter->setPen(pen);
+    painter->setBrush(Qt::NoBrush);
+    painter->drawArc(-radius, -radius, radius * 2, radius * 2,
+                     static_cast<int>(START_ANGLE * 16),
+                     static_cast<int>((angleNow - START_ANGLE) * 16));
+
+    painter->restore();
+}
+
+void RpmGauge::drawNeedle(QPainter *painter)
+{
+    const int radius = gaugeRadius();
+
+    painter->save();
+    painter->translate(gaugeCenter());
+
     // Needle tip segment only (keeps center area clean).
     QColor needleColor = (m_rpm > (MAX_RPM * 0.8f)) ? QColor("#FF4E5F") : QColor("#EAF6FF");
     painter->setPen(QPen(needleColor, 3, Qt::SolidLine, Qt::RoundCap));
     const float a = qDegreesToRadians(m_needleAngle);
-    const float innerLen = radius - 55.0f;
-    const float outerLen = radius - 28.0f;
+    const float innerLen = radius - NEEDLE_INNER_OFFSET;
+    const float outerLen = radius - NEEDLE_OUTER_OFFSET;
     const QPointF p1(qCos(a) * innerLen, -qSin(a) * innerLen);
     const QPointF p2(qCos(a) * outerLen, -qSin(a) * outerLen);
     painter->drawLine(p1, p2);
@@ -135,13 +297,5 @@ void RpmGauge::drawValue(QPainter *painter)
     QRect rpmRect(cx - 100, cy - 62, 200, 60);
     painter->drawText(rpmRect, Qt::AlignCenter, rpmText);
     
-    // Place label directly under the RPM number.
-    QRect labelRect(cx - 72, cy - 8, 144, 20);
-    font.setPointSize(9);
-    font.setWeight(QFont::Medium);
-    painter->setFont(font);
-    painter->setPen(QColor("#9FB4CB"));
-    painter->drawText(labelRect, Qt::AlignHCenter | Qt::AlignVCenter, "Wheel RPM");
-    
     painter->restore();
 }
@@ -9,7 +9,8 @@
 #define RPMGAUGE_H
 
 #include <QWidget>
-#include <QPropertyAnimation>
+#include <QPixmap>
+#include "NeedleDynamics.h"
 
 /**
  * @class RpmGauge
@@ -19,6 +20,9 @@
  * - 180° semi-circle gauge
  * - Range: 0-500 RPM
  * - Cyan blue color theme
+ * - Background arc, ticks and caption cached in a HiDPI-aware pixmap
+ * - Partial repaints: only the needle sweep, the changed part of the
+ *   active arc and the number are invalidated
  */
 class RpmGauge : public QWidget
 {
@@ -32,20 +36,46 @@ public:
     float rpm() const { return m_rpm; }
     float needleAngle() const { return m_needleAngle; }
     void setNeedleAngle(float angle);
+
+    // Called once per display frame; moves the needle and invalidates its sweep.
+    void advance(float dtSeconds);
+    
+    // Needle response (seconds to cover ~95% of a step)
+    void setNeedleResponseTime(float seconds) { m_needle.setResponseTime(seconds); }
+    // Displayed minus actual RPM
+    float needleLag() const;
     
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void changeEvent(QEvent *event) override;
     
 private:
-    void drawGauge(QPainter *painter);
+    QPointF gaugeCenter() const;
+    int gaugeRadius() const;
+    QRect valueRect() const;
+    QRect sweepRect(float fromDeg, float toDeg, float innerRadius, float outerRadius, int pad) const;
+    static float rpmToAngle(float rpm);
+    void moveNeedle(float angle);
+
+    void rebuildStaticLayer();
+    void drawStaticGauge(QPainter *painter);
+    void drawActiveArc(QPainter *painter);
+    void drawNeedle(QPainter *painter);
     void drawValue(QPainter *painter);
     
     float m_rpm;
     float m_needleAngle;
-    QPropertyAnimation *m_needleAnimation;
+    NeedleDynamics m_needle;
+    QPixmap m_staticLayer;      // Arc + ticks + caption, rebuilt on resize/style/DPR change
+    bool m_staticLayerDirty;
     
     // Dashboard display range tuned for current wheel RPM signal.
     static constexpr float MAX_RPM = 120.0f;
+    static constexpr float START_ANGLE = 200.0f;
+    static constexpr float END_ANGLE = -20.0f;
+    static constexpr float NEEDLE_INNER_OFFSET = 55.0f;  // From radius
+    static constexpr float NEEDLE_OUTER_OFFSET = 28.0f;
 };
 
 #endif // RPMGAUGE_H
@@ -6,9 +6,11 @@
  */
 
 #include "SpeedometerWidget.h"
+#include "LatencyTracer.h"
 #include <QPainter>
 #include <QPainterPath>
 #include <QFont>
+#include <QEvent>
 #include <QtMath>
 
 SpeedometerWidget::SpeedometerWidget(QWidget *parent)
@@ -16,66 +18,137 @@ SpeedometerWidget::SpeedometerWidget(QWidget *parent)
     , m_speed(0.0f)
     // Start from 6 o'clock-like position and animate to zero speed on first update.
     , m_needleAngle(-45.0f)
-    , m_lastTargetAngle(-9999.0f)
     , m_startupAnimationDone(false)
-    , m_needleAnimation(nullptr)
+    , m_startupSweepActive(false)
+    , m_startupSweepElapsed(0.0f)
+    , m_contentDirty(false)
+    , m_needleResponseTime(0.22f)
+    , m_needle(0.22f, -45.0f)
+    , m_staticLayerDirty(true)
+    , m_pendingTraceId(0)
 {
-    // Setup needle animation
-    m_needleAnimation = new QPropertyAnimation(this, "needleAngle");
-    m_needleAnimation->setDuration(220);
-    m_needleAnimation->setEasingCurve(QEasingCurve::OutCubic);
 }
 
-void SpeedometerWidget::setSpeed(float speedKmh)
+void SpeedometerWidget::setSpeed(float speedKmh, quint32 traceId)
 {
     // Clamp speed to valid range
     speedKmh = qBound(0.0f, speedKmh, MAX_SPEED);
-    m_speed = speedKmh;
-    
-    // Calculate target needle angle (0-270°)
-    float targetAngle = (speedKmh / MAX_SPEED) * GAUGE_SPAN_ANGLE;
-
-    // Avoid restarting the same animation target every frame.
-    if (qAbs(targetAngle - m_lastTargetAngle) < 0.05f) {
-        return;
+    if (speedKmh != m_speed) {
+        m_speed = speedKmh;
+        m_contentDirty = true;
+        // Unchanged values cause no repaint, so only changes are traced.
+        m_pendingTraceId = traceId;
     }
-    m_lastTargetAngle = targetAngle;
     
-    // Animate needle
-    m_needleAnimation->stop();
-    m_needleAnimation->setStartValue(m_needleAngle);
-    m_needleAnimation->setEndValue(targetAngle);
+    // Calculate target needle angle (0-270°); the spring retargets in place.
+    m_needle.setTarget((speedKmh / MAX_SPEED) * GAUGE_SPAN_ANGLE);
     if (!m_startupAnimationDone) {
         // Startup sweep: slower, ignition-like movement.
-        m_needleAnimation->setDuration(1150);
-        m_needleAnimation->setEasingCurve(QEasingCurve::InOutCubic);
+        m_needle.setResponseTime(STARTUP_RESPONSE_TIME);
+        m_startupSweepActive = true;
+        m_startupSweepElapsed = 0.0f;
         m_startupAnimationDone = true;
-    } else {
-        m_needleAnimation->setDuration(220);
-        m_needleAnimation->setEasingCurve(QEasingCurve::OutCubic);
     }
-    m_needleAnimation->start();
 }
 
 void SpeedometerWidget::setNeedleAngle(float angle)
 {
+    m_needle.reset(angle);
     m_needleAngle = angle;
     update();  // Trigger repaint
 }
 
+void SpeedometerWidget::setNeedleResponseTime(float seconds)
+{
+    m_needleResponseTime = seconds;
+    if (!m_startupSweepActive) {
+        m_needle.setResponseTime(seconds);
+    }
+}
+
+float SpeedometerWidget::needleLag() const
+{
+    return -m_needle.lag() * (MAX_SPEED / GAUGE_SPAN_ANGLE);
+}
+
+void SpeedometerWidget::advance(float dtSeconds)
+{
+    if (m_startupSweepActive) {
+        // The sweep lasts its response time, not until the needle settles:
+        // live speed keeps retargeting the needle, so it may never settle.
+        m_startupSweepElapsed += dtSeconds;
+        if (m_startupSweepElapsed >= STARTUP_RESPONSE_TIME) {
+            m_startupSweepActive = false;
+            m_needle.setResponseTime(m_needleResponseTime);
+        }
+    }
+
+    if (m_needle.advance(dtSeconds)) {
+        m_needleAngle = m_needle.value();
+        m_contentDirty = true;
+    }
+
+    if (m_contentDirty) {
+        m_contentDirty = false;
+        update();
+    }
+}
+
 void SpeedometerWidget::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
     
+    // Static face is rasterized once; moving to a screen with another DPR
+    // invalidates it as well.
+    if (m_staticLayerDirty || m_staticLayer.devicePixelRatio() != devicePixelRatioF()) {
+        rebuildStaticLayer();
+    }
+
     QPainter painter(this);
+    painter.drawPixmap(0, 0, m_staticLayer);
     painter.setRenderHint(QPainter::Antialiasing);
     
-    // Draw components
-    drawGauge(&painter);
-    drawTicks(&painter);
+    // Draw dynamic components
     drawShiftLights(&painter);
     drawNeedle(&painter);
     drawDigitalSpeed(&painter);
+    
+    if (m_pendingTraceId != 0) {
+        painter.end();
+        LatencyTracer::instance().markPainted(m_pendingTraceId);
+        m_pendingTraceId = 0;
+    }
+}
+
+void SpeedometerWidget::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    m_staticLayerDirty = true;
+}
+
+void SpeedometerWidget::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::StyleChange || event->type() == QEvent::PaletteChange
+        || event->type() == QEvent::FontChange) {
+        m_staticLayerDirty = true;
+        update();
+    }
+    QWidget::changeEvent(event);
+}
+
+void SpeedometerWidget::rebuildStaticLayer()
+{
+    const qreal dpr = devicePixelRatioF();
+    m_staticLayer = QPixmap(qMax(1, qRound(width() * dpr)), qMax(1, qRound(height() * dpr)));
+    m_staticLayer.setDevicePixelRatio(dpr);
+    m_staticLayer.fill(Qt::transparent);
+
+    QPainter painter(&m_staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing);
+    drawGauge(&painter);
+    drawTicks(&painter);
+    drawUnitLabel(&painter);
+    m_staticLayerDirty = false;
 }
 
 void SpeedometerWidget::drawGauge(QPainter *painter)
@@ -182,6 +255,7 @@ void SpeedometerWidget::drawTicks(QPainter *painter)
     
     painter->save();
     painter->translate(cx, cy);
+    painter->setFont(QFont("Roboto", 11, QFont::Medium));
     
     // Draw major ticks (0, 5, 10, 15, 20, 25, 30)
     for (int speed = 0; speed <= static_cast<int>(MAX_SPEED); speed += 5) {
@@ -201,8 +275,6 @@ void SpeedometerWidget::drawTicks(QPainter *painter)
         int textX = static_cast<int>((radius - 55) * qCos(textAngle));
         int textY = static_cast<int>((radius - 55) * qSin(textAngle));
         
-        QFont font("Roboto", 11, QFont::Medium);
-        painter->setFont(font);
         painter->setPen(QColor("#C9D8EA"));
         
         QString label = QString::number(speed);
@@ -256,13 +328,13 @@ void SpeedometerWidget::drawNeedle(QPainter *painter)
     painter->restore();
 }
 
-void SpeedometerWidget::drawDigitalSpeed(QPainter *painter)
+void SpeedometerWidget::drawUnitLabel(QPainter *painter)
 {
     const int cx = width() / 2;
     const int cy = height() / 2 + 4;
-    
+
     painter->save();
-    
+
     // Compact center readout (minimal, no chunky rectangle).
     QFont unitFont("Roboto", 10, QFont::Medium);
     painter->setFont(unitFont);
@@ -270,6 +342,16 @@ void SpeedometerWidget::drawDigitalSpeed(QPainter *painter)
     QRect unitRect(cx - 74, cy + 24, 148, 14);
     painter->drawText(unitRect, Qt::AlignHCenter | Qt::AlignVCenter, "km/h");
 
+    painter->restore();
+}
+
+void SpeedometerWidget::drawDigitalSpeed(QPainter *painter)
+{
+    const int cx = width() / 2;
+    const int cy = height() / 2 + 4;
+    
+    painter->save();
+
     // Main speed number
     const QString speedText = QString::number(static_cast<int>(m_speed));
     QFont speedFont("Roboto Mono", 46, QFont::Bold);
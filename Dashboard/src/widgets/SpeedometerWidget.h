@@ -9,7 +9,8 @@
 #define SPEEDOMETERWIDGET_H
 
 #include <QWidget>
-#include <QPropertyAnimation>
+#include <QPixmap>
+#include "NeedleDynamics.h"
 
 /**
  * @class SpeedometerWidget
@@ -17,9 +18,11 @@
  * 
  * Features:
  * - Circular gauge (270° arc)
- * - Animated needle
+ * - Critically-damped needle, stepped by the frame clock via advance()
  * - Digital speed display in center
  * - Red zone for high speeds (25-30 km/h)
+ * - Static face (dial, rings, ticks, labels) cached in a HiDPI-aware pixmap;
+ *   only needle, shift lights and digits are painted per frame
  */
 class SpeedometerWidget : public QWidget
 {
@@ -29,33 +32,54 @@ class SpeedometerWidget : public QWidget
 public:
     explicit SpeedometerWidget(QWidget *parent = nullptr);
     
-    void setSpeed(float speedKmh);
+    // traceId: LatencyTracer trace completed by the paint that first shows this value
+    void setSpeed(float speedKmh, quint32 traceId = 0);
     float speed() const { return m_speed; }
     
     float needleAngle() const { return m_needleAngle; }
     void setNeedleAngle(float angle);
+
+    // Called once per display frame; moves the needle and schedules a repaint if needed.
+    void advance(float dtSeconds);
+    
+    // Needle response (seconds to cover ~95% of a step); applies after the
+    // startup sweep, which lasts STARTUP_RESPONSE_TIME
+    void setNeedleResponseTime(float seconds);
+    // Displayed minus actual speed, km/h (negative while the needle trails upward)
+    float needleLag() const;
     
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void changeEvent(QEvent *event) override;
     
 private:
+    void rebuildStaticLayer();
     void drawGauge(QPainter *painter);
     void drawTicks(QPainter *painter);
     void drawNeedle(QPainter *painter);
     void drawShiftLights(QPainter *painter);
+    void drawUnitLabel(QPainter *painter);
     void drawDigitalSpeed(QPainter *painter);
     
     float m_speed;
     float m_needleAngle;
-    float m_lastTargetAngle;
     bool m_startupAnimationDone;
-    QPropertyAnimation *m_needleAnimation;
+    bool m_startupSweepActive;
+    float m_startupSweepElapsed;   // Seconds since the sweep started
+    bool m_contentDirty;        // Digits/shift lights changed since last frame
+    float m_needleResponseTime;
+    NeedleDynamics m_needle;    // Needle angle relative to the gauge start
+    QPixmap m_staticLayer;      // Gauge face, rebuilt on resize/style/DPR change
+    bool m_staticLayerDirty;
+    quint32 m_pendingTraceId;   // Latest traced value not yet painted, 0 = none
     
     // Constants
     static constexpr float MAX_SPEED = 30.0f;      // km/h
     static constexpr float RED_ZONE_START = 25.0f; // km/h
     static constexpr float GAUGE_START_ANGLE = 135.0f;  // degrees
     static constexpr float GAUGE_SPAN_ANGLE = 270.0f;   // degrees
+    static constexpr float STARTUP_RESPONSE_TIME = 1.15f;  // Ignition-like sweep
 };
 
 #endif // SPEEDOMETERWIDGET_H
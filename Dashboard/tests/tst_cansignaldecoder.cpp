@@ -0,0 +1,270 @@
+/**
+ * @file tst_cansignaldecoder.cpp
+ * @brief CanSignalDecoder Tests on Recorded Frames
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * Frames are written as candump lines ("can0  123   [8]  11 80 ..."), so
+ * captures from the car can be pasted into the tables as they are.
+ */
+
+#include "CanSignalDecoder.h"
+
+#include <QtTest>
+
+namespace {
+
+struct Frame {
+    quint32 canId = 0;
+    quint8 data[8] = {};
+    int dlc = 0;
+};
+
+// "can0  123   [2]  11 80" or "can0  18FEF100   [8]  ..." (8 hex digits = 29-bit ID)
+Frame parseCandump(const QString &line)
+{
+    Frame frame;
+    const QStringList fields = line.simplified().split(' ');
+    if (fields.size() < 3) {
+        return frame;
+    }
+    const QString id = fields.at(1);
+    frame.canId = id.toUInt(nullptr, 16);
+    if (id.size() > 3) {
+        frame.canId |= CanSignalDecoder::EFF_FLAG;
+    }
+    frame.dlc = fields.at(2).mid(1, fields.at(2).size() - 2).toInt();
+    for (int i = 0; i < frame.dlc && i < 8 && 3 + i < fields.size(); ++i) {
+        frame.data[i] = static_cast<quint8>(fields.at(3 + i).toUInt(nullptr, 16));
+    }
+    return frame;
+}
+
+// Value of the signal with this role in the frame, NaN if it was not decoded
+double decodeRole(const CanSignalDecoder &decoder, const QString &role, const Frame &frame)
+{
+    CanSignalDecoder::Value values[CanSignalDecoder::MAX_VALUES_PER_FRAME];
+    const int count = decoder.decode(frame.canId, frame.data, frame.dlc,
+                                     values, CanSignalDecoder::MAX_VALUES_PER_FRAME);
+    const int wanted = decoder.findRole(role);
+    for (int i = 0; i < count; ++i) {
+        if (values[i].signal == wanted) {
+            return values[i].value;
+        }
+    }
+    return qQNaN();
+}
+
+} // namespace
+
+class TestCanSignalDecoder : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaultLayout_data();
+    void defaultLayout();
+    void byteOrder_data();
+    void byteOrder();
+    void dbcFile();
+    void extendedIdFromJson();
+
+private:
+    void addDefaultRows();
+};
+
+void TestCanSignalDecoder::addDefaultRows()
+{
+    QTest::addColumn<QString>("candump");
+    QTest::addColumn<double>("speed");   // NaN = no speed value expected
+    QTest::addColumn<double>("rpm");     // NaN = no rpm value expected
+
+    const double none = qQNaN();
+    // Example from the DBC comment: 0x11 km/h + 0x80/256 km/h
+    QTest::newRow("speed 17.5 km/h") << QStringLiteral("can0  123   [8]  11 80 2A 00 00 00 00 00") << 17.5 << none;
+    QTest::newRow("speed dlc 2") << QStringLiteral("can0  123   [2]  11 80") << 17.5 << none;
+    QTest::newRow("speed 1-byte node") << QStringLiteral("can0  123   [1]  11") << 17.0 << none;
+    QTest::newRow("speed 1-byte node padded") << QStringLiteral("can0  123   [8]  1E 00 00 00 00 00 00 00") << 30.0 << none;
+    QTest::newRow("speed max") << QStringLiteral("can0  123   [2]  FF FF") << 255.99609375 << none;
+    QTest::newRow("speed dlc 0") << QStringLiteral("can0  123   [0]") << none << none;
+    QTest::newRow("rpm float") << QStringLiteral("can0  124   [4]  00 50 9A 44") << none << 1234.5;
+    QTest::newRow("rpm negative") << QStringLiteral("can0  124   [8]  00 00 44 C1 00 00 00 00") << none << -12.25;
+    QTest::newRow("rpm dlc 3") << QStringLiteral("can0  124   [3]  00 50 9A") << none << none;
+    QTest::newRow("unknown id") << QStringLiteral("can0  200   [8]  11 80 00 00 00 00 00 00") << none << none;
+    QTest::newRow("extended 0x123") << QStringLiteral("can0  00000123   [8]  11 80 00 00 00 00 00 00") << none << none;
+}
+
+void TestCanSignalDecoder::defaultLayout_data()
+{
+    addDefaultRows();
+}
+
+void TestCanSignalDecoder::defaultLayout()
+{
+    QFETCH(QString, candump);
+    QFETCH(double, speed);
+    QFETCH(double, rpm);
+
+    CanSignalDecoder builtIn;
+    builtIn.loadDefaults();
+    CanSignalDecoder fromDbc;
+    QVERIFY(fromDbc.loadFile(QStringLiteral(PIRACER_CONFIG_DIR "/piracer.dbc")));
+
+    const Frame frame = parseCandump(candump);
+    for (const CanSignalDecoder *decoder : {&builtIn, &fromDbc}) {
+        const double decodedSpeed = decodeRole(*decoder, "speed_kmh", frame);
+        const double decodedRpm = decodeRole(*decoder, "rpm", frame);
+        QCOMPARE(qIsNaN(decodedSpeed), qIsNaN(speed));
+        QCOMPARE(qIsNaN(decodedRpm), qIsNaN(rpm));
+        if (!qIsNaN(speed)) {
+            QCOMPARE(decodedSpeed, speed);
+        }
+        if (!qIsNaN(rpm)) {
+            QCOMPARE(decodedRpm, rpm);
+        }
+    }
+}
+
+void TestCanSignalDecoder::byteOrder_data()
+{
+    QTest::addColumn<int>("startBit");
+    QTest::addColumn<int>("length");
+    QTest::addColumn<bool>("littleEndian");
+    QTest::addColumn<bool>("isSigned");
+    QTest::addColumn<double>("factor");
+    QTest::addColumn<double>("offset");
+    QTest::addColumn<int>("minDlc");        // 0 = whole signal required
+    QTest::addColumn<QString>("candump");
+    QTest::addColumn<double>("expected");   // NaN = signal skipped
+
+    const double skipped = qQNaN();
+    // Intel (@1): start bit = LSB
+    QTest::newRow("intel u8") << 0 << 8 << true << false << 1.0 << 0.0 << 0
+                              << QStringLiteral("can0  100   [1]  2A") << 42.0;
+    QTest::newRow("intel u16 byte 1") << 8 << 16 << true << false << 1.0 << 0.0 << 0
+                                      << QStringLiteral("can0  100   [3]  00 34 12") << 4660.0;
+    QTest::newRow("intel u12 bit 4") << 4 << 12 << true << false << 1.0 << 0.0 << 0
+                                     << QStringLiteral("can0  100   [2]  AB CD") << 3290.0;
+    QTest::newRow("intel s8") << 0 << 8 << true << true << 1.0 << 0.0 << 0
+                              << QStringLiteral("can0  100   [1]  FE") << -2.0;
+    QTest::newRow("intel s16 scaled") << 0 << 16 << true << true << 0.1 << -40.0 << 0
+                                      << QStringLiteral("can0  100   [2]  E8 03") << 60.0;
+    // Motorola (@0): start bit = MSB in sawtooth numbering
+    QTest::newRow("motorola u16") << 7 << 16 << false << false << 1.0 << 0.0 << 0
+                                  << QStringLiteral("can0  100   [2]  12 34") << 4660.0;
+    QTest::newRow("motorola u16 bytes 2-3") << 23 << 16 << false << false << 1.0 << 0.0 << 0
+                                            << QStringLiteral("can0  100   [4]  00 00 AB CD") << 43981.0;
+    QTest::newRow("motorola u8 byte 1") << 15 << 8 << false << false << 1.0 << 0.0 << 0
+                                        << QStringLiteral("can0  100   [2]  00 7F") << 127.0;
+    QTest::newRow("motorola u12") << 7 << 12 << false << false << 1.0 << 0.0 << 0
+                                  << QStringLiteral("can0  100   [2]  12 34") << 291.0;
+    QTest::newRow("motorola u4 low nibble") << 3 << 4 << false << false << 1.0 << 0.0 << 0
+                                            << QStringLiteral("can0  100   [1]  A5") << 5.0;
+    QTest::newRow("motorola s16") << 7 << 16 << false << true << 1.0 << 0.0 << 0
+                                  << QStringLiteral("can0  100   [2]  FF 38") << -200.0;
+    // Short DLC: a truncated signal is skipped...
+    QTest::newRow("short intel u16") << 8 << 16 << true << false << 1.0 << 0.0 << 0
+                                     << QStringLiteral("can0  100   [2]  00 34") << skipped;
+    QTest::newRow("short intel u8 dlc 0") << 0 << 8 << true << false << 1.0 << 0.0 << 0
+                                          << QStringLiteral("can0  100   [0]") << skipped;
+    QTest::newRow("short motorola u16 msb only") << 7 << 16 << false << false << 1.0 << 0.0 << 0
+                                                 << QStringLiteral("can0  100   [1]  11") << skipped;
+    QTest::newRow("short motorola u16 bytes 2-3") << 23 << 16 << false << false << 1.0 << 0.0 << 0
+                                                  << QStringLiteral("can0  100   [3]  00 00 AB") << skipped;
+    QTest::newRow("short motorola u12") << 7 << 12 << false << false << 1.0 << 0.0 << 0
+                                        << QStringLiteral("can0  100   [1]  12") << skipped;
+    // ...unless it opted in with minDlc: missing bytes read as zero
+    QTest::newRow("min dlc motorola u16 msb only") << 7 << 16 << false << false << 1.0 << 0.0 << 1
+                                                   << QStringLiteral("can0  100   [1]  11") << 4352.0;
+    QTest::newRow("min dlc motorola u16 bytes 2-3") << 23 << 16 << false << false << 1.0 << 0.0 << 3
+                                                    << QStringLiteral("can0  100   [3]  00 00 AB") << 43776.0;
+    QTest::newRow("min dlc not reached") << 23 << 16 << false << false << 1.0 << 0.0 << 3
+                                         << QStringLiteral("can0  100   [2]  00 00") << skipped;
+    QTest::newRow("min dlc intel u16") << 0 << 16 << true << false << 1.0 << 0.0 << 1
+                                       << QStringLiteral("can0  100   [1]  34") << 52.0;
+    QTest::newRow("min dlc above length") << 7 << 8 << false << false << 1.0 << 0.0 << 4
+                                          << QStringLiteral("can0  100   [1]  7F") << 127.0;
+}
+
+void TestCanSignalDecoder::byteOrder()
+{
+    QFETCH(int, startBit);
+    QFETCH(int, length);
+    QFETCH(bool, littleEndian);
+    QFETCH(bool, isSigned);
+    QFETCH(double, factor);
+    QFETCH(double, offset);
+    QFETCH(int, minDlc);
+    QFETCH(QString, candump);
+    QFETCH(double, expected);
+
+    CanSignalDecoder::Signal signal;
+    signal.name = "Test";
+    signal.role = "test";
+    signal.canId = 0x100;
+    signal.startBit = startBit;
+    signal.length = length;
+    signal.littleEndian = littleEndian;
+    signal.isSigned = isSigned;
+    signal.factor = factor;
+    signal.offset = offset;
+    signal.minDlc = minDlc;
+
+    CanSignalDecoder decoder;
+    QVERIFY(decoder.addSignal(signal));
+
+    const double decoded = decodeRole(decoder, "test", parseCandump(candump));
+    QCOMPARE(qIsNaN(decoded), qIsNaN(expected));
+    if (!qIsNaN(expected)) {
+        QCOMPARE(decoded, expected);
+    }
+}
+
+void TestCanSignalDecoder::dbcFile()
+{
+    CanSignalDecoder decoder;
+    QVERIFY(decoder.loadFile(QStringLiteral(PIRACER_CONFIG_DIR "/piracer.dbc")));
+    QCOMPARE(decoder.signalCount(), 3);
+    QCOMPARE(decoder.messageIds(), QVector<quint32>({0x123, 0x124}));
+
+    const int speed = decoder.findRole("speed_kmh");
+    QVERIFY(speed >= 0);
+    QCOMPARE(decoder.signal(speed).startBit, 7);
+    QCOMPARE(decoder.signal(speed).length, 16);
+    QCOMPARE(decoder.signal(speed).littleEndian, false);
+    QCOMPARE(decoder.signal(speed).factor, 1.0 / 256.0);
+    QCOMPARE(decoder.signal(speed).minDlc, 1);   // BA_ "MinDlc", only on Speed
+
+    const int rpm = decoder.findRole("rpm");
+    QVERIFY(rpm >= 0);
+    QCOMPARE(decoder.signal(rpm).floatBits, 32);
+    QCOMPARE(decoder.signal(rpm).minDlc, 0);
+
+    // SpeedCounter has no role but is decoded in the same pass
+    CanSignalDecoder::Value values[CanSignalDecoder::MAX_VALUES_PER_FRAME];
+    const Frame frame = parseCandump("can0  123   [8]  11 80 2A 00 00 00 00 00");
+    QCOMPARE(decoder.decode(frame.canId, frame.data, frame.dlc, values,
+                            CanSignalDecoder::MAX_VALUES_PER_FRAME), 2);
+}
+
+void TestCanSignalDecoder::extendedIdFromJson()
+{
+    CanSignalDecoder decoder;
+    QVERIFY(decoder.loadJson(R"({"messages": [{"id": "0x18FEF100", "extended": true,
+        "signals": [{"name": "WheelSpeed", "role": "speed_kmh",
+                     "start_bit": 8, "length": 16, "factor": 0.00390625, "min_dlc": 2}]}]})"));
+    QCOMPARE(decoder.signal(0).minDlc, 2);
+
+    QCOMPARE(decodeRole(decoder, "speed_kmh", parseCandump("can0  18FEF100   [8]  00 80 11 00 00 00 00 00")),
+             17.5);
+    // The same ID without EFF_FLAG is the 11-bit ID 0x100, not this message
+    Frame standard = parseCandump("can0  18FEF100   [8]  00 80 11 00 00 00 00 00");
+    standard.canId &= ~CanSignalDecoder::EFF_FLAG;
+    QVERIFY(qIsNaN(decodeRole(decoder, "speed_kmh", standard)));
+    // min_dlc 2: byte 2 (high byte) missing reads as zero
+    QCOMPARE(decodeRole(decoder, "speed_kmh", parseCandump("can0  18FEF100   [2]  00 80")), 0.5);
+    QVERIFY(qIsNaN(decodeRole(decoder, "speed_kmh", parseCandump("can0  18FEF100   [1]  00"))));
+}
+
+QTEST_GUILESS_MAIN(TestCanSignalDecoder)
+#include "tst_cansignaldecoder.moc"
@@ -0,0 +1,138 @@
+#!/bin/bash
+# PiRacer CAN soak test
+#
+# Runs the dashboard against a virtual CAN interface while can_load_gen
+# sends a speed/RPM/background frame mix at increasing bus loads, and
+# reports per load step: frames sent and read, frames lost, kernel socket
+# overflows (SO_RXQ_OVFL), dashboard CPU and GUI frame interval.
+#
+# Usage:
+#   can_soak.sh DASHBOARD CAN_LOAD_GEN [--iface vcan0] [--mode notifier|thread]
+#               [--loads "10 25 50 75 100"] [--duration 20] [--mix speed:10,rpm:10,bg:80]
+#
+# Creating the vcan interface needs root (sudo is used when available).
+# The dashboard runs offscreen unless SOAK_DISPLAY=1, from a scratch copy
+# of config/ with can.interface, can.ingest_mode, a mock battery and a
+# scratch recorder file; the real can0, INA219 and ring file are not used.
+#
+# Author: Ahn Hyunjun
+# Date: 2026-10-16
+
+set -u
+
+SCRIPT_DIR=$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )
+
+if [[ $# -lt 2 ]]; then
+	sed -n '9,11p' "$0" | sed 's/^# //'
+	exit 2
+fi
+DASHBOARD=$(realpath "$1")
+LOAD_GEN=$(realpath "$2")
+shift 2
+
+IFACE=vcan0
+MODE=notifier
+LOADS="10 25 50 75 100"
+DURATION=20
+MIX="speed:10,rpm:10,bg:80"
+while [[ $# -gt 0 ]]; do
+	case $1 in
+		--iface) IFACE=$2; shift 2 ;;
+		--mode) MODE=$2; shift 2 ;;
+		--loads) LOADS=$2; shift 2 ;;
+		--duration) DURATION=$2; shift 2 ;;
+		--mix) MIX=$2; shift 2 ;;
+		*) echo "ERROR: unknown option $1"; exit 2 ;;
+	esac
+done
+
+SUDO=""
+if [[ $EUID -ne 0 ]]; then
+	SUDO=sudo
+fi
+if ! ip link show "$IFACE" &> /dev/null; then
+	echo "Creating $IFACE"
+	$SUDO modprobe vcan && $SUDO ip link add dev "$IFACE" type vcan || exit 1
+fi
+$SUDO ip link set up "$IFACE" || exit 1
+
+WORK_DIR=$(mktemp -d /tmp/piracer_soak.XXXXXX)
+trap 'rm -rf "$WORK_DIR"' EXIT
+cp -r "$SCRIPT_DIR/../config" "$WORK_DIR/config"
+python3 - "$WORK_DIR" "$IFACE" "$MODE" <<'EOF'
+import json, sys
+work, iface, mode = sys.argv[1:4]
+path = f"{work}/config/calibration.json"
+with open(path) as f:
+    config = json.load(f)
+config.setdefault("can", {}).update({"interface": iface, "ingest_mode": mode})
+config.setdefault("battery", {})["source"] = "mock"
+config.setdefault("recorder", {})["path"] = f"{work}/telemetry.ring"
+with open(path, "w") as f:
+    json.dump(config, f, indent=2)
+EOF
+
+if [[ ${SOAK_DISPLAY:-0} != 1 ]]; then
+	export QT_QPA_PLATFORM=offscreen
+fi
+
+CLOCK_TICKS=$(getconf CLK_TCK)
+cpu_ticks() {
+	# utime + stime of the process (fields 14 and 15 of /proc/PID/stat)
+	awk '{ print $14 + $15 }' "/proc/$1/stat"
+}
+field() {
+	# First number following "$2" in file $1
+	grep -o "$2 [0-9.]*" "$1" | head -n 1 | awk '{ print $NF }'
+}
+
+echo "$IFACE, ingest mode $MODE, $DURATION s per step, mix $MIX"
+printf "%6s %8s %9s %9s %8s %8s %7s %9s %9s %9s\n" \
+	"load%" "fps" "target" "read" "lost" "sk_drop" "cpu%" "frm_p50" "frm_p99" "frm_max"
+
+for LOAD in $LOADS; do
+	LOG="$WORK_DIR/dashboard_$LOAD.log"
+	( cd "$WORK_DIR" && exec "$DASHBOARD" ) &> "$LOG" &
+	PID=$!
+	sleep 3
+	if ! kill -0 $PID 2> /dev/null; then
+		echo "ERROR: dashboard exited during startup, see below"
+		cat "$LOG"
+		exit 1
+	fi
+
+	TICKS_BEFORE=$(cpu_ticks $PID)
+	START_NS=$(date +%s%N)
+	GEN_OUT=$("$LOAD_GEN" --iface "$IFACE" --load "$LOAD" --mix "$MIX" --duration "$DURATION")
+	TICKS_AFTER=$(cpu_ticks $PID)
+	END_NS=$(date +%s%N)
+
+	# Let the last frames drain, then quit through SIGTERM so totals are logged.
+	sleep 1
+	kill -TERM $PID
+	wait $PID
+
+	RESULT=$(echo "$GEN_OUT" | grep '^RESULT')
+	if [[ -z $RESULT ]]; then
+		echo "ERROR: can_load_gen failed"
+		exit 1
+	fi
+	FPS=$(echo "$RESULT" | grep -o 'fps=[0-9]*' | cut -d= -f2)
+	SPEED=$(echo "$RESULT" | grep -o 'speed=[0-9]*' | cut -d= -f2)
+	RPM=$(echo "$RESULT" | grep -o 'rpm=[0-9]*' | cut -d= -f2)
+	# Background IDs are rejected by the kernel filter, so only 0x123/0x124 count.
+	TARGET=$((SPEED + RPM))
+	READ=$(field "$LOG" "CAN ingest totals: frames")
+	READ=${READ:-0}
+	LOST=$((TARGET > READ ? TARGET - READ : 0))
+	SOCKET_DROPS=$(field "$LOG" "socket drops")
+	CPU=$(awk -v t=$((TICKS_AFTER - TICKS_BEFORE)) -v hz="$CLOCK_TICKS" -v ns=$((END_NS - START_NS)) \
+		'BEGIN { printf "%.1f", 100.0 * t / hz / (ns / 1e9) }')
+	P50=$(grep -o 'GUI frame interval.*' "$LOG" | grep -o 'p50 [0-9.]*' | awk '{ print $2 }')
+	P99=$(grep -o 'GUI frame interval.*' "$LOG" | grep -o 'p99 [0-9.]*' | awk '{ print $2 }')
+	MAX=$(grep -o 'GUI frame interval.*' "$LOG" | grep -o 'max [0-9.]*' | awk '{ print $2 }')
+
+	printf "%6s %8s %9s %9s %8s %8s %7s %9s %9s %9s\n" \
+		"$LOAD" "$FPS" "$TARGET" "$READ" "$LOST" "${SOCKET_DROPS:--}" "$CPU" \
+		"${P50:--}ms" "${P99:--}ms" "${MAX:--}ms"
+done
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+PiRacer Telemetry Ring Dump
+===========================
+
+Reads the memory-mapped ring file written by the dashboard's
+TelemetryRecorder (see src/utils/TelemetryRecord.h) and prints the valid
+records in write order as CSV. Works on a file left behind by a crashed or
+killed dashboard, and while the dashboard is still writing.
+
+Usage:
+    python3 ring_dump.py [/var/tmp/piracer_telemetry.ring]
+                         [--last SECONDS] [--kind speed,rpm,...] [--session N]
+                         [--summary]
+
+Author: Ahn Hyunjun
+Date: 2026-10-16
+"""
+
+import argparse
+import mmap
+import struct
+import sys
+from datetime import datetime
+
+HEADER_FORMAT = "<IHHIIIIqQII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_FORMAT = "<QqfHHII"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+MAGIC = 0x52545250  # "PRTR"
+VERSION = 1
+
+KINDS = {
+    0: "session_start",
+    1: "speed",
+    2: "rpm",
+    3: "can_signal",
+    4: "battery_voltage",
+    5: "battery_current_ma",
+    6: "battery_percent",
+    7: "direction",
+}
+SOURCES = {0: "dashboard", 1: "can", 2: "ina219", 3: "bridge", 4: "drive_mode"}
+
+
+def read_ring(path):
+    """Return (header dict, records sorted by sequence)."""
+    with open(path, "rb") as f:
+        data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    try:
+        (magic, version, _, header_size, record_size, capacity, retention_s,
+         created_ns, write_index, sessions, _) = struct.unpack_from(HEADER_FORMAT, data, 0)
+        if magic != MAGIC or version != VERSION or record_size != RECORD_SIZE:
+            raise ValueError(f"{path}: not a version {VERSION} telemetry ring")
+        if len(data) < header_size + capacity * record_size:
+            raise ValueError(f"{path}: file is shorter than its header claims")
+
+        # Only the last `capacity` sequence numbers can still be in the ring.
+        oldest = max(1, write_index - capacity + 1)
+        records = []
+        for slot, record in enumerate(struct.iter_unpack(
+                RECORD_FORMAT, data[header_size:header_size + capacity * record_size])):
+            sequence = record[0]
+            # A half-written record still holds 0 or a sequence from another slot.
+            if sequence < oldest or sequence > write_index or (sequence - 1) % capacity != slot:
+                continue
+            records.append(record)
+    finally:
+        data.close()
+
+    records.sort(key=lambda r: r[0])
+    header = {
+        "capacity": capacity,
+        "retention_s": retention_s,
+        "created_ns": created_ns,
+        "write_index": write_index,
+        "sessions": sessions,
+    }
+    return header, records
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Dump the dashboard telemetry ring file")
+    parser.add_argument("path", nargs="?", default="/var/tmp/piracer_telemetry.ring")
+    parser.add_argument("--last", type=float, default=None,
+                        help="seconds before the newest record to keep "
+                             "(default: retention stored in the file, 0 = everything)")
+    parser.add_argument("--kind", default="",
+                        help="comma-separated kinds to keep: " + ",".join(KINDS.values()))
+    parser.add_argument("--session", type=int, default=None,
+                        help="only records after the given session_start")
+    parser.add_argument("--summary", action="store_true",
+                        help="print per-kind counts instead of records")
+    args = parser.parse_args()
+
+    try:
+        header, records = read_ring(args.path)
+    except (OSError, ValueError) as exc:
+        print(f"Error: {exc}", file=sys.stderr)
+        return 1
+
+    if args.session is not None:
+        start = next((i for i, r in enumerate(records) if r[3] == 0 and r[5] == args.session), None)
+        end = next((i for i, r in enumerate(records) if r[3] == 0 and r[5] == args.session + 1),
+                   len(records))
+        records = records[start:end] if start is not None else []
+
+    window = header["retention_s"] if args.last is None else args.last
+    if window > 0 and records:
+        newest = max(r[1] for r in records)
+        cutoff = newest - int(window * 1e9)
+        records = [r for r in records if r[1] >= cutoff]
+
+    if args.kind:
+        wanted = {k.strip() for k in args.kind.split(",") if k.strip()}
+        unknown = wanted - set(KINDS.values())
+        if unknown:
+            print(f"Error: unknown kind(s): {', '.join(sorted(unknown))}", file=sys.stderr)
+            return 1
+        records = [r for r in records if KINDS.get(r[3]) in wanted]
+
+    print(f"# {args.path}: capacity {header['capacity']}, written {header['write_index']}, "
+          f"sessions {header['sessions']}, retention {header['retention_s']} s, "
+          f"{len(records)} record(s) selected", file=sys.stderr)
+
+    if args.summary:
+        counts = {}
+        for r in records:
+            name = KINDS.get(r[3], str(r[3]))
+            counts[name] = counts.get(name, 0) + 1
+        for name, count in sorted(counts.items()):
+            print(f"{name},{count}")
+        if records:
+            span = (records[-1][1] - records[0][1]) / 1e9
+            print(f"span_s,{span:.3f}")
+        return 0
+
+    print("sequence,time,timestamp_ns,kind,source,value,aux")
+    for sequence, timestamp_ns, value, kind, source, aux, _ in records:
+        when = datetime.fromtimestamp(timestamp_ns / 1e9).isoformat(timespec="milliseconds")
+        print(f"{sequence},{when},{timestamp_ns},{KINDS.get(kind, kind)},"
+              f"{SOURCES.get(source, source)},{value:.6g},{aux}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
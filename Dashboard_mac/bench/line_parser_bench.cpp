@@ -0,0 +1,187 @@
+/**
+ * @file line_parser_bench.cpp
+ * @brief SpeedLineParser Benchmark on Recorded Serial Captures
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ *
+ * Usage:
+ *   line_parser_bench [capture.txt ...]
+ *
+ * A capture is the raw byte stream of a text firmware build, e.g.
+ *   cat /dev/ttyUSB0 > capture.txt
+ * Without arguments a synthetic capture (startup banner plus 20000 speed
+ * lines) is used.
+ *
+ * The capture is fed in uneven chunks (1-64 bytes, like readyRead() at
+ * 9600 baud) to the former SerialReader text path (QString buffer,
+ * contains/indexOf/left/mid, QRegularExpression per line) and to
+ * SpeedLineParser, and lines/s plus the sum of parsed speeds of both are
+ * reported.
+ */
+
+#include "SpeedLineParser.h"
+
+#include <QByteArray>
+#include <QRegularExpression>
+#include <QString>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// SerialReader::onReadyRead()/parseData() before SpeedLineParser
+class ReferenceReader
+{
+public:
+    int feed(const char *data, int size)
+    {
+        int values = 0;
+        m_buffer += QString::fromUtf8(data, size);
+        while (m_buffer.contains('\n')) {
+            int newlinePos = m_buffer.indexOf('\n');
+            QString line = m_buffer.left(newlinePos).trimmed();
+            m_buffer = m_buffer.mid(newlinePos + 1);
+
+            if (!line.isEmpty()) {
+                QRegularExpression re(R"(Speed:\s+([\d.]+)\s+pulse/s)");
+                QRegularExpressionMatch match = re.match(line);
+                if (match.hasMatch()) {
+                    m_sum += match.captured(1).toFloat();
+                    values++;
+                }
+            }
+        }
+        return values;
+    }
+
+    double sum() const { return m_sum; }
+
+private:
+    QString m_buffer;
+    double m_sum = 0.0;
+};
+
+QByteArray loadCapture(const char *path)
+{
+    QByteArray capture;
+    FILE *file = std::fopen(path, "rb");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return capture;
+    }
+    char chunk[4096];
+    size_t length;
+    while ((length = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        capture.append(chunk, static_cast<int>(length));
+    }
+    std::fclose(file);
+    return capture;
+}
+
+QByteArray syntheticCapture()
+{
+    // Same lines as displaySpeed() of a text build, speed ramping up and down
+    QByteArray capture =
+        "=========================================\r\n"
+        "   PiRacer Speed Sensor System v1.0     \r\n"
+        "=========================================\r\n"
+        "Sensor: LM393 IR Speed Sensor\r\n"
+        "Platform: Arduino Uno (ATmega328P)\r\n"
+        "Mode: Pulse counting (pin 2)\r\n"
+        "Output: Text\r\n"
+        "Update Interval: 500 ms\r\n"
+        "=========================================\r\n"
+        "Starting measurements...\r\n"
+        "\r\n";
+    char line[96];
+    for (int i = 0; i < 20000; ++i) {
+        const int pulses = (i % 400) < 200 ? (i % 400) : 400 - (i % 400);
+        const int length = std::snprintf(line, sizeof(line),
+                                         "Pulses: %d | Speed: %.2f pulse/s | Time: %.2f s\r\n",
+                                         pulses, pulses * 2.0, i * 0.5);
+        capture.append(line, length);
+    }
+    return capture;
+}
+
+std::vector<int> chunkSizes(int total)
+{
+    std::vector<int> sizes;
+    unsigned seed = 12345;
+    for (int offset = 0; offset < total;) {
+        seed = seed * 1103515245u + 12345u;
+        const int size = qMin(1 + static_cast<int>((seed >> 16) % 64), total - offset);
+        sizes.push_back(size);
+        offset += size;
+    }
+    return sizes;
+}
+
+void runCapture(const char *name, const QByteArray &capture)
+{
+    if (capture.isEmpty()) {
+        return;
+    }
+    constexpr int REPEATS = 5;
+    using Clock = std::chrono::steady_clock;
+    const std::vector<int> sizes = chunkSizes(capture.size());
+
+    long referenceValues = 0;
+    double referenceSum = 0.0;
+    const auto referenceStart = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        ReferenceReader reference;
+        const char *data = capture.constData();
+        for (int size : sizes) {
+            referenceValues += reference.feed(data, size);
+            data += size;
+        }
+        referenceSum = reference.sum();
+    }
+    const double referenceS =
+        std::chrono::duration<double>(Clock::now() - referenceStart).count();
+
+    long parserValues = 0;
+    double parserSum = 0.0;
+    const auto parserStart = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        SpeedLineParser parser;
+        parserSum = 0.0;
+        const char *data = capture.constData();
+        for (int size : sizes) {
+            for (int i = 0; i < size; ++i) {
+                if (parser.push(data[i])) {
+                    parserSum += parser.value();
+                    parserValues++;
+                }
+            }
+            data += size;
+        }
+    }
+    const double parserS =
+        std::chrono::duration<double>(Clock::now() - parserStart).count();
+
+    const double lines = static_cast<double>(capture.count('\n')) * REPEATS;
+    std::printf("%s: %d bytes, %lld lines, %d chunks\n", name, capture.size(),
+                static_cast<long long>(capture.count('\n')), static_cast<int>(sizes.size()));
+    std::printf("  QString + regex   %12.0f lines/s  %7ld values  sum %.2f\n",
+                lines / referenceS, referenceValues / REPEATS, referenceSum);
+    std::printf("  SpeedLineParser   %12.0f lines/s  %7ld values  sum %.2f  (%.1fx)\n",
+                lines / parserS, parserValues / REPEATS, parserSum, referenceS / parserS);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        runCapture("synthetic", syntheticCapture());
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        runCapture(argv[i], loadCapture(argv[i]));
+    }
+    return 0;
+}
@@ -25,6 +25,8 @@ SOURCES += \
     src/widgets/RpmGauge.cpp \
     src/widgets/BatteryWidget.cpp \
     src/serial/SerialReader.cpp \
+    src/serial/SpeedFrameDecoder.cpp \
+    src/serial/SpeedLineParser.cpp \
     src/utils/DataProcessor.cpp \
     src/utils/CalibrationManager.cpp
 
@@ -35,6 +37,8 @@ HEADERS += \
     src/widgets/RpmGauge.h \
     src/widgets/BatteryWidget.h \
     src/serial/SerialReader.h \
+    src/serial/SpeedFrameDecoder.h \
+    src/serial/SpeedLineParser.h \
     src/utils/DataProcessor.h \
     src/utils/CalibrationManager.h
 
@@ -7,15 +7,23 @@
 
 #include "SerialReader.h"
 #include <QSerialPortInfo>
-#include <QRegularExpression>
 #include <QDebug>
 
 SerialReader::SerialReader(QObject *parent)
     : QObject(parent)
     , m_serialPort(nullptr)
     , m_reconnectTimer(nullptr)
+    , m_baudRate(DEFAULT_BAUD_RATE)
     , m_isConnected(false)
 {
+    bool ok = false;
+    const int baudRate = qEnvironmentVariableIntValue("PIRACER_SERIAL_BAUD", &ok);
+    if (ok && baudRate > 0) {
+        m_baudRate = baudRate;
+    } else if (qEnvironmentVariableIsSet("PIRACER_SERIAL_BAUD")) {
+        qWarning() << "Ignoring invalid PIRACER_SERIAL_BAUD, using" << m_baudRate;
+    }
+
     m_serialPort = new QSerialPort(this);
     
     // Connect signals
@@ -41,6 +49,7 @@ SerialReader::~SerialReader()
     if (m_serialPort->isOpen()) {
         m_serialPort->close();
     }
+    logFrameStats();
 }
 
 bool SerialReader::isConnected() const
@@ -61,17 +70,19 @@ bool SerialReader::connectToArduino()
     }
     
     m_serialPort->setPortName(portName);
-    m_serialPort->setBaudRate(QSerialPort::Baud9600);
+    m_serialPort->setBaudRate(m_baudRate);
     m_serialPort->setDataBits(QSerialPort::Data8);
     m_serialPort->setParity(QSerialPort::NoParity);
     m_serialPort->setStopBits(QSerialPort::OneStop);
     m_serialPort->setFlowControl(QSerialPort::NoFlowControl);
     
     if (m_serialPort->open(QIODevice::ReadOnly)) {
+        m_decoder.reset();
+        m_lineParser.reset();
         m_isConnected = true;
         m_reconnectTimer->stop();
         emit connectionStatusChanged(true);
-        qDebug() << "Connected to Arduino on" << portName;
+        qDebug() << "Connected to Arduino on" << portName << "at" << m_baudRate << "baud";
         return true;
     }
     
@@ -107,36 +118,27 @@ QString SerialReader::findArduinoPort()
 
 void SerialReader::onReadyRead()
 {
-    // Read available data
-    QByteArray data = m_serialPort->readAll();
-    m_buffer += QString::fromUtf8(data);
-    
-    // Process complete lines
-    while (m_buffer.contains('\n')) {
-        int newlinePos = m_buffer.indexOf('\n');
-        QString line = m_buffer.left(newlinePos).trimmed();
-        m_buffer = m_buffer.mid(newlinePos + 1);
-        
-        if (!line.isEmpty()) {
-            parseData(line);
+    // Read into a fixed buffer; binary frames are decoded without allocating
+    qint64 length;
+    while ((length = m_serialPort->read(m_readBuffer, READ_CHUNK_SIZE)) > 0) {
+        for (qint64 i = 0; i < length; ++i) {
+            switch (m_decoder.push(static_cast<quint8>(m_readBuffer[i]))) {
+            case SpeedFrameDecoder::FrameReady:
+                emit speedDataReceived(m_decoder.frame().pulsePerSec());
+                break;
+            case SpeedFrameDecoder::Skipped:
+                // Startup banner or text debug firmware
+                if (m_lineParser.push(m_readBuffer[i])) {
+                    emit speedDataReceived(m_lineParser.value());
+                }
+                break;
+            case SpeedFrameDecoder::Pending:
+                break;
+            }
         }
     }
 }
 
-void SerialReader::parseData(const QString &line)
-{
-    // Expected format: "Pulses: 42 | Speed: 84.00 pulse/s | Time: 12.34 s"
-    
-    // Extract speed using regex
-    QRegularExpression re(R"(Speed:\s+([\d.]+)\s+pulse/s)");
-    QRegularExpressionMatch match = re.match(line);
-    
-    if (match.hasMatch()) {
-        float pulsePerSec = match.captured(1).toFloat();
-        emit speedDataReceived(pulsePerSec);
-    }
-}
-
 void SerialReader::onErrorOccurred(QSerialPort::SerialPortError error)
 {
     if (error == QSerialPort::ResourceError ||
@@ -147,6 +149,7 @@ void SerialReader::onErrorOccurred(QSerialPort::SerialPortError error)
         if (m_serialPort->isOpen()) {
             m_serialPort->close();
         }
+        logFrameStats();
         
         m_isConnected = false;
         emit connectionStatusChanged(false);
@@ -163,3 +166,16 @@ void SerialReader::attemptReconnect()
     qDebug() << "Attempting to reconnect to Arduino...";
     connectToArduino();
 }
+
+void SerialReader::logFrameStats() const
+{
+    const SpeedFrameStats &stats = m_decoder.stats();
+    if (stats.frames == 0 && stats.crcErrors == 0) {
+        return;  // Nothing binary received (text firmware or never connected)
+    }
+    qDebug() << "Speed frames:" << stats.frames
+             << "CRC errors:" << stats.crcErrors
+             << "sequence gaps:" << stats.sequenceGaps
+             << "lost:" << stats.lostFrames
+             << "skipped bytes:" << stats.skippedBytes;
+}
@@ -11,6 +11,8 @@
 #include <QObject>
 #include <QSerialPort>
 #include <QTimer>
+#include "SpeedFrameDecoder.h"
+#include "SpeedLineParser.h"
 
 /**
  * @class SerialReader
@@ -18,8 +20,12 @@
  * 
  * Features:
  * - Auto-detect Arduino port
- * - Parse speed data (pulse/s)
+ * - Decode binary speed frames (SpeedFrameDecoder), CRC and sequence checked
+ * - Parse text speed lines (pulse/s) from text debug firmware builds
+ *   (SpeedLineParser, no allocation per line)
  * - Auto-reconnection on disconnect
+ * - Baud rate from PIRACER_SERIAL_BAUD (default 9600), must match
+ *   SERIAL_BAUD_RATE of the firmware environment
  */
 class SerialReader : public QObject
 {
@@ -31,6 +37,8 @@ public:
     
     bool isConnected() const;
     QString currentPort() const;
+    qint32 baudRate() const { return m_baudRate; }
+    const SpeedFrameStats &frameStats() const { return m_decoder.stats(); }
     
 signals:
     void speedDataReceived(float pulsePerSec);
@@ -44,11 +52,17 @@ private slots:
 private:
     bool connectToArduino();
     QString findArduinoPort();
-    void parseData(const QString &line);
+    void logFrameStats() const;
+    
+    static constexpr int READ_CHUNK_SIZE = 256;
+    static constexpr qint32 DEFAULT_BAUD_RATE = 9600;
     
     QSerialPort *m_serialPort;
     QTimer *m_reconnectTimer;
-    QString m_buffer;
+    SpeedFrameDecoder m_decoder;
+    char m_readBuffer[READ_CHUNK_SIZE];
+    SpeedLineParser m_lineParser;
+    qint32 m_baudRate;
     bool m_isConnected;
 };
 
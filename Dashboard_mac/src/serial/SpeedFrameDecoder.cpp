@@ -0,0 +1,93 @@
+/**
+ * @file SpeedFrameDecoder.cpp
+ * @brief Speed Frame Decoder Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "SpeedFrameDecoder.h"
+#include <cstring>
+
+SpeedFrameDecoder::SpeedFrameDecoder()
+    : m_length(0)
+    , m_haveSequence(false)
+{
+}
+
+void SpeedFrameDecoder::reset()
+{
+    // Counters are kept; a new connection only restarts framing
+    m_length = 0;
+    m_haveSequence = false;
+}
+
+SpeedFrameDecoder::Result SpeedFrameDecoder::push(quint8 byte)
+{
+    if (m_length == 0 && byte != SYNC) {
+        m_stats.skippedBytes++;
+        return Skipped;
+    }
+
+    m_buffer[m_length++] = byte;
+    if (m_length < FRAME_SIZE) {
+        return Pending;
+    }
+
+    if (crc8(m_buffer + 1, FRAME_SIZE - 2) != m_buffer[FRAME_SIZE - 1]) {
+        m_stats.crcErrors++;
+        resync();
+        return Pending;
+    }
+
+    parseFrame();
+    m_length = 0;
+    return FrameReady;
+}
+
+void SpeedFrameDecoder::resync()
+{
+    // Restart at the next sync byte after the rejected one, if any
+    int start = 1;
+    while (start < m_length && m_buffer[start] != SYNC) {
+        start++;
+    }
+    m_stats.skippedBytes += start;
+    m_length -= start;
+    std::memmove(m_buffer, m_buffer + start, m_length);
+}
+
+void SpeedFrameDecoder::parseFrame()
+{
+    const quint8 *data = m_buffer;
+    const quint8 sequence = data[1];
+
+    if (m_haveSequence) {
+        const quint8 missing = static_cast<quint8>(sequence - m_frame.sequence - 1);
+        if (missing != 0) {
+            m_stats.sequenceGaps++;
+            m_stats.lostFrames += missing;
+        }
+    }
+    m_haveSequence = true;
+
+    m_frame.sequence = sequence;
+    m_frame.timestampUs = quint32(data[2]) | (quint32(data[3]) << 8) |
+                          (quint32(data[4]) << 16) | (quint32(data[5]) << 24);
+    m_frame.pulses = quint16(data[6] | (data[7] << 8));
+    m_frame.periodUs = quint32(data[8]) | (quint32(data[9]) << 8) |
+                       (quint32(data[10]) << 16) | (quint32(data[11]) << 24);
+    m_stats.frames++;
+}
+
+quint8 SpeedFrameDecoder::crc8(const quint8 *data, int length)
+{
+    // Polynomial 0x07, initial value 0, same as the firmware's crc8()
+    quint8 crc = 0;
+    while (length--) {
+        crc ^= *data++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? quint8((crc << 1) ^ 0x07) : quint8(crc << 1);
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file SpeedFrameDecoder.h
+ * @brief Streaming Decoder for the Arduino Binary Speed Frame
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef SPEEDFRAMEDECODER_H
+#define SPEEDFRAMEDECODER_H
+
+#include <QtGlobal>
+
+/**
+ * @struct SpeedFrame
+ * @brief One decoded speed frame (see ADUINO/docs/API.md, Binary Speed Frame)
+ */
+struct SpeedFrame
+{
+    quint8 sequence = 0;
+    quint32 timestampUs = 0;    // Arduino micros(), wraps after ~71 minutes
+    quint16 pulses = 0;         // Edges in the firmware's update interval
+    quint32 periodUs = 0;       // 0 = stopped
+
+    float pulsePerSec() const { return periodUs ? 1000000.0f / periodUs : 0.0f; }
+};
+
+/**
+ * @struct SpeedFrameStats
+ * @brief Link quality counters of a SpeedFrameDecoder
+ */
+struct SpeedFrameStats
+{
+    quint64 frames = 0;         // Frames with a valid CRC
+    quint64 crcErrors = 0;      // Candidate frames rejected by the CRC
+    quint64 sequenceGaps = 0;   // Times the sequence number jumped
+    quint64 lostFrames = 0;     // Frames missing according to the sequence numbers
+    quint64 skippedBytes = 0;   // Bytes outside frames (text, noise, resync)
+};
+
+/**
+ * @class SpeedFrameDecoder
+ * @brief Byte-at-a-time decoder for the 13-byte speed frame
+ *
+ * Features:
+ * - No allocation: one fixed frame buffer
+ * - Hunts for the 0xA5 sync byte, then collects a full frame
+ * - CRC-8 (poly 0x07) check; on failure resynchronizes on the next sync
+ *   byte inside the rejected frame, so a real frame that started inside
+ *   corrupted data is not lost
+ * - Sequence gap and lost frame counters
+ *
+ * Bytes that are not part of a frame are reported as Skipped so the caller
+ * can hand them to the text-line parser (startup banner, text debug builds).
+ */
+class SpeedFrameDecoder
+{
+public:
+    enum Result {
+        Pending,    // Byte buffered, frame not complete yet
+        FrameReady, // Byte completed a valid frame, see frame()
+        Skipped     // Byte is not part of a frame
+    };
+
+    static constexpr quint8 SYNC = 0xA5;
+    static constexpr int FRAME_SIZE = 13;
+
+    SpeedFrameDecoder();
+
+    Result push(quint8 byte);
+    void reset();
+
+    const SpeedFrame &frame() const { return m_frame; }
+    const SpeedFrameStats &stats() const { return m_stats; }
+
+    static quint8 crc8(const quint8 *data, int length);
+
+private:
+    void parseFrame();
+    void resync();
+
+    quint8 m_buffer[FRAME_SIZE];
+    int m_length;
+    bool m_haveSequence;
+    SpeedFrame m_frame;
+    SpeedFrameStats m_stats;
+};
+
+#endif // SPEEDFRAMEDECODER_H
@@ -0,0 +1,124 @@
+/**
+ * @file SpeedLineParser.cpp
+ * @brief Speed Line Parser Implementation
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#include "SpeedLineParser.h"
+
+namespace {
+
+const char LABEL[] = "Speed:";
+const char UNIT[] = "pulse/s";
+constexpr int LABEL_LENGTH = sizeof(LABEL) - 1;
+constexpr int UNIT_LENGTH = sizeof(UNIT) - 1;
+
+bool isSpace(char byte)
+{
+    return byte == ' ' || byte == '\t' || byte == '\r';
+}
+
+bool isDigit(char byte)
+{
+    return byte >= '0' && byte <= '9';
+}
+
+} // namespace
+
+SpeedLineParser::SpeedLineParser()
+    : m_state(Label)
+    , m_matched(0)
+    , m_haveSpace(false)
+    , m_haveDigit(false)
+    , m_haveDecimal(false)
+    , m_number(0.0)
+    , m_scale(0.1)
+    , m_value(0.0f)
+{
+}
+
+void SpeedLineParser::reset()
+{
+    m_state = Label;
+    m_matched = 0;
+}
+
+void SpeedLineParser::restart(char byte)
+{
+    // The failing byte may itself start a new label
+    m_state = Label;
+    m_matched = (byte == LABEL[0]) ? 1 : 0;
+}
+
+bool SpeedLineParser::push(char byte)
+{
+    switch (m_state) {
+    case Label:
+        if (byte == LABEL[m_matched]) {
+            if (++m_matched == LABEL_LENGTH) {
+                m_state = LeadingSpace;
+                m_haveSpace = false;
+            }
+        } else {
+            restart(byte);
+        }
+        return false;
+
+    case LeadingSpace:
+        if (isSpace(byte)) {
+            m_haveSpace = true;
+            return false;
+        }
+        if (!m_haveSpace || !(isDigit(byte) || byte == '.')) {
+            restart(byte);
+            return false;
+        }
+        m_state = Number;
+        m_haveDigit = false;
+        m_haveDecimal = false;
+        m_number = 0.0;
+        m_scale = 0.1;
+        // The first number byte falls through
+        Q_FALLTHROUGH();
+
+    case Number:
+        if (isDigit(byte)) {
+            m_haveDigit = true;
+            if (m_haveDecimal) {
+                m_number += (byte - '0') * m_scale;
+                m_scale *= 0.1;
+            } else {
+                m_number = m_number * 10.0 + (byte - '0');
+            }
+        } else if (byte == '.' && !m_haveDecimal) {
+            m_haveDecimal = true;
+        } else if (isSpace(byte) && m_haveDigit) {
+            m_state = TrailingSpace;
+        } else {
+            restart(byte);
+        }
+        return false;
+
+    case TrailingSpace:
+        if (isSpace(byte)) {
+            return false;
+        }
+        m_state = Unit;
+        m_matched = 0;
+        Q_FALLTHROUGH();
+
+    case Unit:
+        if (byte != UNIT[m_matched]) {
+            restart(byte);
+            return false;
+        }
+        if (++m_matched < UNIT_LENGTH) {
+            return false;
+        }
+        m_value = static_cast<float>(m_number);
+        reset();
+        return true;
+    }
+    return false;
+}
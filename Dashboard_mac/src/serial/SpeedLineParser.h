@@ -0,0 +1,57 @@
+/**
+ * @file SpeedLineParser.h
+ * @brief Incremental Parser for the Arduino Text Speed Line
+ * @author Ahn Hyunjun
+ * @date 2026-10-16
+ */
+
+#ifndef SPEEDLINEPARSER_H
+#define SPEEDLINEPARSER_H
+
+#include <QtGlobal>
+
+/**
+ * @class SpeedLineParser
+ * @brief Extracts the speed from "Pulses: 42 | Speed: 84.00 pulse/s | Time: 12.34 s"
+ *
+ * Features:
+ * - Byte-at-a-time state machine, no line buffer, no QString, no regex
+ * - Accepts the same field as the former regex: "Speed:", whitespace,
+ *   digits with an optional decimal point, whitespace, "pulse/s"
+ * - The value is ready as soon as "pulse/s" is complete, before the
+ *   rest of the line arrives
+ * - A newline or any unexpected byte restarts the search
+ */
+class SpeedLineParser
+{
+public:
+    SpeedLineParser();
+
+    // Returns true when the byte completed a speed field, see value()
+    bool push(char byte);
+    void reset();
+
+    float value() const { return m_value; }
+
+private:
+    enum State {
+        Label,          // Matching "Speed:"
+        LeadingSpace,   // At least one whitespace after the label
+        Number,         // Digits and one optional '.'
+        TrailingSpace,  // At least one whitespace after the number
+        Unit            // Matching "pulse/s"
+    };
+
+    void restart(char byte);
+
+    State m_state;
+    int m_matched;          // Characters of the label/unit matched so far
+    bool m_haveSpace;
+    bool m_haveDigit;
+    bool m_haveDecimal;
+    double m_number;
+    double m_scale;         // Place value of the next fraction digit
+    float m_value;
+};
+
+#endif // SPEEDLINEPARSER_H